@@ -0,0 +1,66 @@
+#include "Bench.h"
+#include "../experiments/Experiment.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+using namespace std;
+
+static volatile long long sink = 0;
+
+void keep_result(long long value) {
+    sink = sink + value;
+}
+
+BenchResult summarize_samples(const string& kernel, const string& instance, long long calls,
+                              vector<double> samplesNs) {
+    sort(samplesNs.begin(), samplesNs.end());
+    BenchResult result;
+    result.kernel = kernel;
+    result.instance = instance;
+    result.samples = (int)samplesNs.size();
+    result.callsPerSample = calls;
+    result.minNs = samplesNs.empty() ? 0.0 : samplesNs.front();
+    result.medianNs = median(samplesNs);
+    result.p90Ns = percentile(samplesNs, 90);
+    result.p99Ns = percentile(samplesNs, 99);
+    return result;
+}
+
+// Tiempo con la unidad que lo deja entre 1 y 1000
+static string human_time(double ns) {
+    const char* units[] = {"ns", "us", "ms", "s"};
+    int unit = 0;
+    while (ns >= 1000.0 && unit < 3) {
+        ns /= 1000.0;
+        ++unit;
+    }
+    ostringstream text;
+    text << fixed << setprecision(ns < 10.0 ? 2 : ns < 100.0 ? 1 : 0) << ns << " " << units[unit];
+    return text.str();
+}
+
+void print_header(ostream& out) {
+    out << left << setw(28) << "Nucleo" << setw(14) << "Instancia" << right << setw(12) << "min"
+        << setw(12) << "mediana" << setw(12) << "p90" << setw(12) << "p99" << setw(12) << "llamadas" << endl;
+}
+
+void print_result(ostream& out, const BenchResult& result) {
+    out << left << setw(28) << result.kernel << setw(14) << result.instance << right
+        << setw(12) << human_time(result.minNs) << setw(12) << human_time(result.medianNs)
+        << setw(12) << human_time(result.p90Ns) << setw(12) << human_time(result.p99Ns)
+        << setw(12) << result.callsPerSample << endl;
+}
+
+void write_results_csv(ostream& out, const vector<BenchResult>& results) {
+    out << "kernel,instance,samples,calls_per_sample,min_ns,median_ns,p90_ns,p99_ns\n";
+    out << fixed << setprecision(1);
+    for (const BenchResult& result : results) {
+        out << result.kernel << ',' << result.instance << ',' << result.samples << ','
+            << result.callsPerSample << ',' << result.minNs << ',' << result.medianNs << ','
+            << result.p90Ns << ',' << result.p99Ns << '\n';
+    }
+    out.unsetf(ios::fixed);
+    out << setprecision(6);
+}
@@ -0,0 +1,72 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+// Micro-benchmarks sin dependencias externas: cada núcleo se calienta, se repite en
+// muestras de al menos minSampleMs y se reporta el tiempo por llamada (mínimo, mediana
+// y percentiles 90/99 de las muestras).
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <ostream>
+#include <string>
+#include <vector>
+
+struct BenchOptions {
+    int warmup = 3;              // muestras descartadas antes de medir
+    int samples = 21;
+    double minSampleMs = 2.0;    // cada muestra repite el núcleo hasta durar esto
+};
+
+struct BenchResult {
+    std::string kernel;
+    std::string instance;
+    int samples = 0;
+    long long callsPerSample = 0;
+    double minNs = 0.0;          // por llamada
+    double medianNs = 0.0;
+    double p90Ns = 0.0;
+    double p99Ns = 0.0;
+};
+
+// Guarda el resultado de un núcleo en un volátil para que el compilador no lo descarte
+void keep_result(long long value);
+
+// Resumen de los tiempos por llamada de cada muestra
+BenchResult summarize_samples(const std::string& kernel, const std::string& instance, long long calls,
+                              std::vector<double> samplesNs);
+
+// 'body' es una llamada al núcleo que devuelve algo derivado de su resultado
+template <class Body>
+BenchResult measure(const std::string& kernel, const std::string& instance, const BenchOptions& options,
+                    Body&& body) {
+    using clock = std::chrono::steady_clock;
+    auto run_sample = [&](long long calls) {
+        auto start = clock::now();
+        long long acc = 0;
+        for (long long c = 0; c < calls; ++c) acc += body();
+        std::chrono::duration<double, std::nano> elapsed = clock::now() - start;
+        keep_result(acc);
+        return elapsed.count();
+    };
+
+    // Llamadas por muestra a partir de una llamada suelta, corregidas con el
+    // calentamiento (la primera llamada suele pagar fallos de caché y de página)
+    double minSampleNs = options.minSampleMs * 1e6;
+    auto calls_for = [&](double ns, long long calls) {
+        double perCall = ns / calls;
+        return perCall <= 0.0 ? 1000LL : std::max(1LL, (long long)std::ceil(minSampleNs / perCall));
+    };
+    long long calls = calls_for(run_sample(1), 1);
+    for (int w = 0; w < options.warmup; ++w) calls = calls_for(run_sample(calls), calls);
+
+    std::vector<double> samplesNs;
+    for (int s = 0; s < options.samples; ++s) samplesNs.push_back(run_sample(calls) / calls);
+    return summarize_samples(kernel, instance, calls, samplesNs);
+}
+
+void print_header(std::ostream& out);
+void print_result(std::ostream& out, const BenchResult& result);
+void write_results_csv(std::ostream& out, const std::vector<BenchResult>& results);
+
+#endif
@@ -0,0 +1,166 @@
+#include "Bench.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+#include "../../Segundo-Corte/genetic-algorithm/GA.h"
+#include "../../Segundo-Corte/tabu-search/TS.h"
+#include "../../Tercer-Corte/memetic/MA.h"
+#include "../../Tercer-Corte/scatter-search/SS.h"
+#include "../../Tercer-Corte/ant-colony/ACO.h"
+#include "../pr_rg/pr_rg.h"
+#include "../../Primer-Corte/NEH.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static void usage() {
+    cerr << "Uso: bench [opciones] [instancias...]\n"
+         << "  --filter=TEXTO   solo los núcleos cuyo nombre contiene TEXTO\n"
+         << "  --samples=N      muestras medidas por núcleo (21)\n"
+         << "  --warmup=N       muestras de calentamiento descartadas (3)\n"
+         << "  --min-ms=X       duración mínima de cada muestra (2)\n"
+         << "  --csv=ARCHIVO    resultados en CSV\n"
+         << "Instancias: archivos, directorios o nombres ta001-ta120; sin ninguna, las de Instances.h\n";
+}
+
+// Un vecindario de inserción completo como en local_search_insertion: cada trabajo en
+// cada otra posición, evaluando la secuencia entera
+static int insertion_scan(const vector<int>& seq, const vector<vector<int>>& tiempos, int m) {
+    int n = seq.size();
+    int best = INT_MAX;
+    for (int i = 0; i < n; ++i) {
+        for (int j = 0; j < n; ++j) {
+            if (i == j) continue;
+            vector<int> vecino = seq;
+            int tarea = vecino[i];
+            vecino.erase(vecino.begin() + i);
+            vecino.insert(vecino.begin() + j, tarea);
+            best = min(best, calcular_makespan(vecino, tiempos, m));
+        }
+    }
+    return best;
+}
+
+// El mismo vecindario con la aceleración de Taillard, como en
+// local_search_insertion_taillard: cada trabajo se extrae y se reinserta en su mejor
+// posición
+static int insertion_scan_taillard(const vector<int>& seq, const vector<vector<int>>& tiempos, int m) {
+    int best = INT_MAX;
+    for (int tarea : seq) {
+        vector<int> vecino = seq;
+        vecino.erase(find(vecino.begin(), vecino.end(), tarea));
+        best = min(best, insertar_mejor_posicion(vecino, tarea, tiempos, m));
+    }
+    return best;
+}
+
+int main(int argc, char** argv) {
+    BenchOptions options;
+    string filter, csvPath;
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg[0] != '-') continue;
+        size_t eq = arg.find('=');
+        string name = arg.substr(0, eq);
+        string value = eq == string::npos ? "" : arg.substr(eq + 1);
+        if (name == "--filter") filter = value;
+        else if (name == "--samples") options.samples = max(1, atoi(value.c_str()));
+        else if (name == "--warmup") options.warmup = max(0, atoi(value.c_str()));
+        else if (name == "--min-ms") options.minSampleMs = atof(value.c_str());
+        else if (name == "--csv") csvPath = value;
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
+
+    vector<BenchResult> results;
+    for (const FlatInstance& instance : instances) {
+        const vector<vector<int>> tiempos = instance.job_rows();
+        const int n = instance.n;
+        const int m = instance.m;
+        const string& label = instance.name;
+
+        auto bench = [&](const string& kernel, auto&& body) {
+            if (kernel.find(filter) == string::npos) return;
+            results.push_back(measure(kernel, label, options, body));
+            print_result(cout, results.back());
+        };
+
+        // Entradas fijas: la secuencia NEH y una permutación aleatoria como destino
+        const vector<int> seq = instance.aggregates().neh_sequence();
+        vector<int> target = seq;
+        shuffle(target.begin(), target.end(), mt19937(1));
+
+        cout << "Instancia: " << label << " (n=" << n << ", m=" << m << ")" << endl;
+        print_header(cout);
+
+        // Todas las copias de la evaluación del makespan (las de Segundo-Corte/grasp y
+        // Segundo-Corte/tabu-search son idénticas a la de Primer-Corte/NEH.cpp)
+        bench("makespan/neh", [&] { return calcular_makespan(seq, tiempos, m); });
+        bench("makespan/ga", [&] { return compute_makespan_ga(seq, tiempos, m); });
+        bench("makespan/ma", [&] { return compute_makespan_ma(seq, tiempos, m); });
+        bench("makespan/ss", [&] { return compute_makespan_ss(seq, tiempos, m); });
+        bench("makespan/aco", [&] { return compute_makespan_aco(seq, tiempos, m); });
+        bench("makespan/pr", [&] { return compute_makespan_pr(seq, tiempos, m); });
+
+        bench("neh", [&] { return neh(n, m, tiempos).front(); });
+
+        bench("insercion/completa", [&] { return insertion_scan(seq, tiempos, m); });
+        bench("insercion/taillard", [&] { return insertion_scan_taillard(seq, tiempos, m); });
+
+        // Lista tabú llena (tenencia 7, la de main) y un movimiento que no está: el peor caso
+        queue<MovimientoTabu> lista_tabu;
+        for (int k = 0; k < 7; ++k) lista_tabu.push({seq[k % n], k});
+        bench("tabu/es_tabu", [&] { return (long long)es_tabu(lista_tabu, seq[n - 1], n - 1); });
+
+        // Cruce de dos puntos sobre la mitad central y la reparación sola
+        int a = n / 4, b = (3 * n) / 4;
+        vector<int> broken = seq;
+        for (int i = a; i <= b; ++i) broken[i] = target[i];
+        vector<int> c1, c2;
+        bench("ga/two_point_crossover", [&] {
+            two_point_crossover(seq, target, a, b, c1, c2);
+            return c1.front() + c2.front();
+        });
+        bench("ga/repair_permutation", [&] { return repair_permutation(broken, n).front(); });
+
+        // Feromona inicial y la heurística de run_aco_pfsp
+        ACOParams acoParams;
+        vector<vector<double>> tau(n, vector<double>(n, 1.0));
+        vector<double> jobHeuristic(n);
+        for (int job = 0; job < n; ++job) {
+            jobHeuristic[job] = 1.0 / (1.0 + instance.aggregates().job_total[job]);
+        }
+        mt19937 rng(1);
+        bench("aco/construct_solution", [&] {
+            return construct_solution(tau, jobHeuristic, n, m, acoParams, rng).front();
+        });
+
+        long long evaluations = 0;
+        bench("ss/path_relinking", [&] { return path_relinking(seq, target, tiempos, m, evaluations).front(); });
+        bench("pr/path_relink_best_of_path", [&] {
+            return path_relink_best_of_path(seq, target, tiempos, m, rng, evaluations).front();
+        });
+        cout << endl;
+    }
+
+    if (!csvPath.empty()) {
+        ofstream out(csvPath);
+        if (out) write_results_csv(out, results);
+        if (!out) {
+            cerr << csvPath << ": no se pudo escribir" << endl;
+            return 1;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,273 @@
+#include "Algorithms.h"
+#include "../../Segundo-Corte/genetic-algorithm/GA.h"
+#include "../../Tercer-Corte/memetic/MA.h"
+#include "../../Tercer-Corte/scatter-search/SS.h"
+#include "../../Tercer-Corte/ant-colony/ACO.h"
+#include "../pr_rg/pr_rg.h"
+#include "../iterated-greedy/IG.h"
+#include "../../Segundo-Corte/grasp/grasp.h"
+#include "../../Segundo-Corte/tabu-search/TS.h"
+#include "../../Primer-Corte/ILS.h"
+
+#include <climits>
+#include <cstdlib>
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+static double param(const ParamSet& params, const char* key) {
+    for (const auto& value : params.values) {
+        if (value.first == key) return value.second;
+    }
+    return 0.0;
+}
+
+// Iteraciones y límite de tiempo de los solvers con campos iterations/timeLimitMs
+template <class Params>
+static void apply_budget(Params& p, const Budget& budget, const FlatInstance& instance, int defaultIterations) {
+    p.iterations = budget.is_default() ? defaultIterations : budget.iterations;
+    p.timeLimitMs = budget.time_limit_ms(instance);
+}
+
+template <class Result>
+static RunOutcome outcome_of(const Result& result) {
+    RunOutcome outcome;
+    outcome.sequence = result.bestSequence;
+    outcome.makespan = result.bestMakespan;
+    outcome.evaluations = result.evaluations;
+    outcome.trace = result.trace.points();
+    outcome.profile = result.profile;
+    return outcome;
+}
+
+// Iteraciones de cada main según el tamaño de la instancia
+static int aco_iterations(int n) { return n <= 20 ? 220 : n <= 50 ? 180 : 120; }
+static int pr_iterations(int n) { return n <= 20 ? 220 : n <= 50 ? 200 : 180; }
+
+static RunOutcome run_ga(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                         unsigned int seed, const Budget& budget) {
+    GAParams p;
+    p.populationSize = (int)param(params, "populationSize");
+    p.crossoverProb = param(params, "crossoverProb");
+    p.mutationProb = param(params, "mutationProb");
+    p.seed = seed;
+    apply_budget(p, budget, instance, 150 * (instance.n + instance.m));
+    return outcome_of(run_genetic_algorithm(tiempos, instance.n, instance.m, p));
+}
+
+static RunOutcome run_ma(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                         unsigned int seed, const Budget& budget) {
+    MAParams p;
+    p.populationSize = (int)param(params, "populationSize");
+    p.recombinationProb = param(params, "recombinationProb");
+    p.mutationProb = param(params, "mutationProb");
+    p.tournamentSize = (int)param(params, "tournamentSize");
+    p.localSearchIters = (int)param(params, "localSearchIters");
+    p.eliteCount = (int)param(params, "eliteCount");
+    p.seed = seed;
+    apply_budget(p, budget, instance, 220);
+    return outcome_of(run_memetic_algorithm(tiempos, instance.n, instance.m, p));
+}
+
+static RunOutcome run_ss(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                         unsigned int seed, const Budget& budget) {
+    SSParams p;
+    p.populationSize = (int)param(params, "populationSize");
+    p.recombinationProb = param(params, "recombinationProb");
+    p.mutationProb = param(params, "mutationProb");
+    p.tournamentSize = (int)param(params, "tournamentSize");
+    p.localSearchIters = (int)param(params, "localSearchIters");
+    p.eliteCount = (int)param(params, "eliteCount");
+    p.diversityThreshold = (int)param(params, "diversityThreshold");
+    p.pathRelinkingRate = param(params, "pathRelinkingRate");
+    p.seed = seed;
+    apply_budget(p, budget, instance, 220);
+    return outcome_of(run_scatter_search(tiempos, instance.n, instance.m, p));
+}
+
+static RunOutcome run_aco(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                          unsigned int seed, const Budget& budget) {
+    ACOParams p;
+    p.antCount = (int)param(params, "antCount");
+    p.alpha = param(params, "alpha");
+    p.beta = param(params, "beta");
+    p.rho = param(params, "rho");
+    p.q0 = param(params, "q0");
+    p.Q = param(params, "Q");
+    p.seed = seed;
+    p.aggregates = &instance.aggregates();
+    apply_budget(p, budget, instance, aco_iterations(instance.n));
+    return outcome_of(run_aco_pfsp(tiempos, instance.n, instance.m, p));
+}
+
+static RunOutcome run_pr_rg(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                            unsigned int seed, const Budget& budget) {
+    PRParams p;
+    p.networkSize = (int)param(params, "networkSize");
+    p.eliteCount = (int)param(params, "eliteCount");
+    p.boredomLimit = (int)param(params, "boredomLimit");
+    p.localSearchPasses = (int)param(params, "localSearchPasses");
+    p.localSearchTrials = (int)param(params, "localSearchTrials");
+    p.listenerCount = (int)param(params, "listenerCount");
+    p.relinkingPeriod = (int)param(params, "relinkingPeriod");
+    p.explorerRandomRate = param(params, "explorerRandomRate");
+    p.guidedRefinementProb = param(params, "guidedRefinementProb");
+    p.seed = seed;
+    p.aggregates = &instance.aggregates();
+    apply_budget(p, budget, instance, pr_iterations(instance.n));
+    return outcome_of(run_rumor_propagation_pfsp(tiempos, instance.n, instance.m, p));
+}
+
+static RunOutcome run_ig(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                         unsigned int seed, const Budget& budget) {
+    IGParams p;
+    p.destructionSize = (int)param(params, "destructionSize");
+    p.temperature = param(params, "temperature");
+    p.localSearch = param(params, "localSearch") != 0.0;
+    p.seed = seed;
+    p.aggregates = &instance.aggregates();
+    p.iterations = budget.iterations;
+    p.timeLimitMs = budget.is_default() ? instance.n * (instance.m / 2.0) * 30 : budget.time_limit_ms(instance);
+    IGResult result = run_iterated_greedy(tiempos, instance.n, instance.m, p);
+    RunOutcome outcome = outcome_of(result);
+    outcome.partialEvaluations = result.partialEvaluations;
+    return outcome;
+}
+
+static RunOutcome run_grasp(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                            unsigned int seed, const Budget& budget) {
+    // Semilla distinta de 0 para que GRASP no use rand(), que comparten todos los hilos
+    unsigned int semilla = seed != 0 ? seed : random_device{}();
+    RunOutcome outcome;
+    ConvergenceTrace trace;
+    int iterations = budget.is_default() ? 50 : budget.iterations;
+    outcome.sequence = ejecutarGRASP(instance.n, instance.m, tiempos, iterations, param(params, "alpha"),
+                                     budget.time_limit_ms(instance), &outcome.evaluations, semilla, &trace,
+                                     &outcome.profile);
+    outcome.trace = trace.points();
+    outcome.makespan = calcular_makespan(outcome.sequence, tiempos, instance.m);
+    return outcome;
+}
+
+static RunOutcome run_ts(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                         unsigned int seed, const Budget& budget) {
+    (void)seed;   // la búsqueda tabú es determinista desde NEH
+    RunOutcome outcome;
+    ConvergenceTrace trace;
+    int iterations = budget.is_default() ? 10000 : budget.iterations > 0 ? budget.iterations : INT_MAX;
+    outcome.sequence = tabu_search(instance.aggregates().neh_sequence(), tiempos, instance.m, iterations,
+                                   (int)param(params, "tabu_tenure"), (int)param(params, "max_sin_mejora"),
+                                   budget.time_limit_ms(instance), &outcome.evaluations, &trace, &outcome.profile);
+    outcome.trace = trace.points();
+    outcome.makespan = calcular_makespan(outcome.sequence, tiempos, instance.m);
+    return outcome;
+}
+
+static RunOutcome run_ils(const FlatInstance& instance, const vector<vector<int>>& tiempos, const ParamSet& params,
+                          unsigned int seed, const Budget& budget) {
+    ILSParams p;
+    p.fuerza = (int)param(params, "fuerza");
+    p.max_sin_mejora = (int)(param(params, "max_sin_mejora_n") * instance.n);
+    p.semilla = seed;
+    p.max_iters = budget.iterations;
+    p.tiempo_limite_ms = budget.is_default() ? instance.n * (instance.m / 2.0) * 30 : budget.time_limit_ms(instance);
+    ILSResult result = ILS_presupuesto(instance.aggregates().neh_sequence(), tiempos, instance.m, p);
+
+    RunOutcome outcome;
+    outcome.sequence = result.mejor;
+    outcome.makespan = result.mejor_makespan;
+    outcome.evaluations = result.evaluaciones_completas;
+    outcome.partialEvaluations = result.evaluaciones;
+    outcome.trace = result.traza.points();
+    outcome.profile = result.perfil;
+    return outcome;
+}
+
+static vector<ParamSet> numbered(const vector<vector<pair<string, double>>>& sets) {
+    vector<ParamSet> presets;
+    for (size_t i = 0; i < sets.size(); ++i) presets.push_back({to_string(i + 1), sets[i]});
+    return presets;
+}
+
+const vector<AlgorithmInfo>& registered_algorithms() {
+    static const vector<AlgorithmInfo> algorithms = {
+        {"ga", numbered({
+             {{"populationSize", 150}, {"crossoverProb", 0.85}, {"mutationProb", 0.15}},
+         }), run_ga},
+        {"ma", numbered({
+             {{"populationSize", 100}, {"recombinationProb", 1.00}, {"mutationProb", 0.50}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+             {{"populationSize", 100}, {"recombinationProb", 0.90}, {"mutationProb", 0.60}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+             {{"populationSize", 100}, {"recombinationProb", 0.80}, {"mutationProb", 0.70}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+             {{"populationSize", 100}, {"recombinationProb", 0.70}, {"mutationProb", 0.80}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+             {{"populationSize", 100}, {"recombinationProb", 0.60}, {"mutationProb", 0.90}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+             {{"populationSize", 100}, {"recombinationProb", 0.50}, {"mutationProb", 1.00}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}},
+         }), run_ma},
+        {"ss", numbered({
+             {{"populationSize", 100}, {"recombinationProb", 0.9}, {"mutationProb", 0.6}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}, {"diversityThreshold", 25}, {"pathRelinkingRate", 0.20}},
+             {{"populationSize", 100}, {"recombinationProb", 0.9}, {"mutationProb", 0.6}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}, {"diversityThreshold", 25}, {"pathRelinkingRate", 0.30}},
+             {{"populationSize", 100}, {"recombinationProb", 0.9}, {"mutationProb", 0.6}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}, {"diversityThreshold", 25}, {"pathRelinkingRate", 0.40}},
+             {{"populationSize", 100}, {"recombinationProb", 0.9}, {"mutationProb", 0.6}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}, {"diversityThreshold", 25}, {"pathRelinkingRate", 0.50}},
+             {{"populationSize", 100}, {"recombinationProb", 0.9}, {"mutationProb", 0.6}, {"tournamentSize", 5}, {"localSearchIters", 30}, {"eliteCount", 3}, {"diversityThreshold", 25}, {"pathRelinkingRate", 0.60}},
+         }), run_ss},
+        {"aco", numbered({
+             {{"antCount", 25}, {"alpha", 1.0}, {"beta", 2.0}, {"rho", 0.15}, {"q0", 0.85}, {"Q", 100.0}},
+             {{"antCount", 35}, {"alpha", 1.1}, {"beta", 2.5}, {"rho", 0.20}, {"q0", 0.90}, {"Q", 120.0}},
+         }), run_aco},
+        {"pr_rg", numbered({
+             {{"networkSize", 80}, {"eliteCount", 3}, {"boredomLimit", 16}, {"localSearchPasses", 3}, {"localSearchTrials", 10}, {"listenerCount", 40}, {"relinkingPeriod", 14}, {"explorerRandomRate", 0.40}, {"guidedRefinementProb", 0.80}},
+             {{"networkSize", 90}, {"eliteCount", 3}, {"boredomLimit", 18}, {"localSearchPasses", 4}, {"localSearchTrials", 12}, {"listenerCount", 45}, {"relinkingPeriod", 12}, {"explorerRandomRate", 0.35}, {"guidedRefinementProb", 0.85}},
+             {{"networkSize", 100}, {"eliteCount", 4}, {"boredomLimit", 24}, {"localSearchPasses", 6}, {"localSearchTrials", 18}, {"listenerCount", 60}, {"relinkingPeriod", 8}, {"explorerRandomRate", 0.25}, {"guidedRefinementProb", 0.95}},
+         }), run_pr_rg},
+        {"ig", numbered({
+             {{"destructionSize", 4}, {"temperature", 0.4}, {"localSearch", 1}},
+         }), run_ig},
+        {"grasp", numbered({
+             {{"alpha", 0.1}}, {{"alpha", 0.3}}, {{"alpha", 0.5}}, {{"alpha", 0.7}}, {{"alpha", 0.9}},
+         }), run_grasp},
+        {"ts", numbered({
+             {{"tabu_tenure", 7}, {"max_sin_mejora", 1000}},
+         }), run_ts},
+        // max_sin_mejora_n: iteraciones sin mejora antes de reiniciar, por trabajo
+        {"ils", numbered({
+             {{"fuerza", 5}, {"max_sin_mejora_n", 20}},
+         }), run_ils},
+    };
+    return algorithms;
+}
+
+const AlgorithmInfo* find_algorithm(const string& name) {
+    for (const AlgorithmInfo& algorithm : registered_algorithms()) {
+        if (algorithm.name == name) return &algorithm;
+    }
+    return nullptr;
+}
+
+bool custom_param_set(const AlgorithmInfo& algorithm, const string& overrides, ParamSet& out, string& error) {
+    out = algorithm.presets.front();
+    out.label = overrides;
+
+    stringstream items(overrides);
+    string item;
+    while (getline(items, item, ',')) {
+        size_t eq = item.find('=');
+        string key = item.substr(0, eq);
+        bool found = false;
+        for (auto& value : out.values) {
+            if (value.first != key) continue;
+            char* end = nullptr;
+            const char* text = eq == string::npos ? "" : item.c_str() + eq + 1;
+            value.second = strtod(text, &end);
+            if (end == text || *end != '\0') {
+                error = "valor inválido en '" + item + "'";
+                return false;
+            }
+            found = true;
+        }
+        if (!found) {
+            error = algorithm.name + " no tiene el parámetro '" + key + "'";
+            return false;
+        }
+    }
+    return true;
+}
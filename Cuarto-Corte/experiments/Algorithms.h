@@ -0,0 +1,33 @@
+#ifndef ALGORITHMS_H
+#define ALGORITHMS_H
+
+// Registro de los algoritmos que puede correr el arnés. Cada uno trae sus
+// configuraciones predefinidas (las mismas de su main) y un adaptador que arma sus
+// parámetros a partir de un ParamSet, una semilla y un presupuesto.
+
+#include "Experiment.h"
+
+#include <string>
+#include <vector>
+
+typedef RunOutcome (*SolverAdapter)(const FlatInstance& instance,
+                                    const std::vector<std::vector<int>>& tiempos,
+                                    const ParamSet& params,
+                                    unsigned int seed,
+                                    const Budget& budget);
+
+struct AlgorithmInfo {
+    std::string name;
+    std::vector<ParamSet> presets;   // todas traen todos los campos, en el mismo orden
+    SolverAdapter run;
+};
+
+const std::vector<AlgorithmInfo>& registered_algorithms();
+const AlgorithmInfo* find_algorithm(const std::string& name);
+
+// Configuración a partir de la primera predefinida con los valores "campo=valor,..."
+// cambiados. Devuelve false con el motivo en 'error' si un campo no existe.
+bool custom_param_set(const AlgorithmInfo& algorithm, const std::string& overrides, ParamSet& out,
+                      std::string& error);
+
+#endif
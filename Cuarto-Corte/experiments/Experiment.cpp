@@ -0,0 +1,348 @@
+#include "Experiment.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iomanip>
+#include <map>
+#include <sstream>
+#include <tuple>
+
+using namespace std;
+
+vector<RunSpec> ExperimentMatrix::runs() const {
+    vector<RunSpec> specs;
+    for (size_t i = 0; i < instances.size(); ++i) {
+        for (size_t a = 0; a < algorithms.size(); ++a) {
+            for (size_t c = 0; c < configs[a].size(); ++c) {
+                for (size_t b = 0; b < budgets.size(); ++b) {
+                    for (unsigned int seed : seeds) {
+                        RunSpec spec;
+                        spec.algorithm = a;
+                        spec.config = c;
+                        spec.instance = i;
+                        spec.budget = b;
+                        spec.seed = seed;
+                        specs.push_back(spec);
+                    }
+                }
+            }
+        }
+    }
+    return specs;
+}
+
+double percentile(const vector<double>& sorted, double p) {
+    if (sorted.empty()) return 0.0;
+    size_t rank = static_cast<size_t>(ceil(p / 100.0 * sorted.size()));
+    return sorted[rank == 0 ? 0 : min(rank, sorted.size()) - 1];
+}
+
+double median(const vector<double>& sorted) {
+    if (sorted.empty()) return 0.0;
+    size_t mid = sorted.size() / 2;
+    return sorted.size() % 2 ? sorted[mid] : (sorted[mid - 1] + sorted[mid]) / 2.0;
+}
+
+void assign_references(const ExperimentMatrix& matrix, vector<RunRecord>& records) {
+    vector<int> bestFound(matrix.instances.size(), 0);
+    for (const RunRecord& record : records) {
+        int& best = bestFound[record.spec.instance];
+        if (best == 0 || record.outcome.makespan < best) best = record.outcome.makespan;
+    }
+
+    for (RunRecord& record : records) {
+        const FlatInstance& instance = matrix.instances[record.spec.instance];
+        record.bestFoundReference = instance.upper_bound <= 0;
+        record.reference = record.bestFoundReference ? bestFound[record.spec.instance] : instance.upper_bound;
+        record.rpd = record.reference > 0
+                         ? 100.0 * (record.outcome.makespan - record.reference) / record.reference
+                         : 0.0;
+    }
+}
+
+static RunSummary summarize_group(const vector<const RunRecord*>& group) {
+    RunSummary summary;
+    vector<double> rpds, seconds;
+    double makespanSum = 0.0;
+    double secondsSum = 0.0;
+    for (const RunRecord* record : group) {
+        int ms = record->outcome.makespan;
+        if (summary.runs == 0 || ms < summary.bestMakespan) summary.bestMakespan = ms;
+        summary.runs++;
+        makespanSum += ms;
+        if (record->reference > 0) rpds.push_back(record->rpd);
+        seconds.push_back(record->seconds);
+        secondsSum += record->seconds;
+        summary.evaluations += record->outcome.evaluations;
+        summary.partialEvaluations += record->outcome.partialEvaluations;
+    }
+    sort(rpds.begin(), rpds.end());
+    sort(seconds.begin(), seconds.end());
+
+    summary.meanMakespan = summary.runs ? makespanSum / summary.runs : 0.0;
+    summary.rpdRuns = rpds.size();
+    if (!rpds.empty()) {
+        double sum = 0.0;
+        for (double rpd : rpds) sum += rpd;
+        summary.meanRpd = sum / rpds.size();
+        summary.medianRpd = median(rpds);
+        summary.bestRpd = rpds.front();
+        summary.worstRpd = rpds.back();
+    }
+    summary.p50Seconds = percentile(seconds, 50);
+    summary.p90Seconds = percentile(seconds, 90);
+    summary.p99Seconds = percentile(seconds, 99);
+    summary.evaluationsPerSecond = secondsSum > 0.0 ? summary.evaluations / secondsSum : 0.0;
+    return summary;
+}
+
+vector<RunSummary> summarize(const ExperimentMatrix& matrix, const vector<RunRecord>& records) {
+    // Grupos en el orden algoritmo, configuración, presupuesto; dentro de cada uno,
+    // las instancias en orden y al final el global (si hay más de una instancia)
+    map<tuple<size_t, size_t, size_t, long>, vector<const RunRecord*>> groups;
+    for (const RunRecord& record : records) {
+        const RunSpec& s = record.spec;
+        groups[make_tuple(s.algorithm, s.config, s.budget, (long)s.instance)].push_back(&record);
+        if (matrix.instances.size() > 1) {
+            groups[make_tuple(s.algorithm, s.config, s.budget, (long)matrix.instances.size())].push_back(&record);
+        }
+    }
+
+    vector<RunSummary> summaries;
+    for (const auto& entry : groups) {
+        RunSummary summary = summarize_group(entry.second);
+        summary.algorithm = get<0>(entry.first);
+        summary.config = get<1>(entry.first);
+        summary.budget = get<2>(entry.first);
+        long instance = get<3>(entry.first);
+        summary.instance = instance == (long)matrix.instances.size() ? -1 : instance;
+        summaries.push_back(summary);
+    }
+    return summaries;
+}
+
+// Campo CSV, entre comillas si hace falta
+static string csv_field(const string& text) {
+    if (text.find_first_of(",\"\n") == string::npos) return text;
+    string quoted = "\"";
+    for (char c : text) {
+        if (c == '"') quoted += '"';
+        quoted += c;
+    }
+    return quoted + "\"";
+}
+
+static string json_string(const string& text) {
+    string out = "\"";
+    for (char c : text) {
+        if (c == '"' || c == '\\') {
+            out += '\\';
+            out += c;
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            char escaped[8];
+            snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+            out += escaped;
+        } else {
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+static string number(double value) {
+    ostringstream out;
+    out << setprecision(10) << value;
+    return out.str();
+}
+
+static string sequence_text(const vector<int>& sequence, const char* separator) {
+    string text;
+    for (size_t i = 0; i < sequence.size(); ++i) {
+        if (i) text += separator;
+        text += to_string(sequence[i] + 1);
+    }
+    return text;
+}
+
+static string params_text(const ParamSet& params) {
+    string text;
+    for (size_t i = 0; i < params.values.size(); ++i) {
+        if (i) text += ' ';
+        text += params.values[i].first + "=" + number(params.values[i].second);
+    }
+    return text;
+}
+
+static double per_second(long long evaluations, double seconds) {
+    return seconds > 0.0 ? evaluations / seconds : 0.0;
+}
+
+void write_runs_csv(ostream& out, const ExperimentMatrix& matrix, const vector<RunRecord>& records) {
+    out << "algorithm,config,params,instance,n,m,seed,budget,time_limit_ms,makespan,reference,reference_kind,"
+           "rpd,seconds,evaluations,evaluations_per_second,partial_evaluations,sequence\n";
+    for (const RunRecord& record : records) {
+        const RunSpec& s = record.spec;
+        const FlatInstance& instance = matrix.instances[s.instance];
+        const ParamSet& params = matrix.configs[s.algorithm][s.config];
+        const Budget& budget = matrix.budgets[s.budget];
+        out << csv_field(matrix.algorithms[s.algorithm]) << ','
+            << csv_field(params.label) << ','
+            << csv_field(params_text(params)) << ','
+            << csv_field(instance.name) << ','
+            << instance.n << ',' << instance.m << ','
+            << s.seed << ','
+            << csv_field(budget.label) << ','
+            << number(budget.time_limit_ms(instance)) << ','
+            << record.outcome.makespan << ','
+            << record.reference << ','
+            << (record.reference > 0 ? (record.bestFoundReference ? "best_found" : "upper_bound") : "") << ','
+            << (record.reference > 0 ? number(record.rpd) : "") << ','
+            << number(record.seconds) << ','
+            << record.outcome.evaluations << ','
+            << number(per_second(record.outcome.evaluations, record.seconds)) << ','
+            << record.outcome.partialEvaluations << ','
+            << sequence_text(record.outcome.sequence, " ") << '\n';
+    }
+}
+
+static string summary_instance_name(const ExperimentMatrix& matrix, const RunSummary& summary) {
+    return summary.instance < 0 ? "*" : matrix.instances[summary.instance].name;
+}
+
+void write_summary_csv(ostream& out, const ExperimentMatrix& matrix, const vector<RunSummary>& summaries) {
+    out << "algorithm,config,budget,instance,runs,best_makespan,mean_makespan,rpd_runs,mean_rpd,median_rpd,"
+           "best_rpd,worst_rpd,p50_seconds,p90_seconds,p99_seconds,evaluations,evaluations_per_second,"
+           "partial_evaluations\n";
+    for (const RunSummary& summary : summaries) {
+        out << csv_field(matrix.algorithms[summary.algorithm]) << ','
+            << csv_field(matrix.configs[summary.algorithm][summary.config].label) << ','
+            << csv_field(matrix.budgets[summary.budget].label) << ','
+            << csv_field(summary_instance_name(matrix, summary)) << ','
+            << summary.runs << ','
+            << (summary.instance < 0 ? "" : to_string(summary.bestMakespan)) << ','
+            << (summary.instance < 0 ? "" : number(summary.meanMakespan)) << ','
+            << summary.rpdRuns << ','
+            << (summary.rpdRuns > 0 ? number(summary.meanRpd) : "") << ','
+            << (summary.rpdRuns > 0 ? number(summary.medianRpd) : "") << ','
+            << (summary.rpdRuns > 0 ? number(summary.bestRpd) : "") << ','
+            << (summary.rpdRuns > 0 ? number(summary.worstRpd) : "") << ','
+            << number(summary.p50Seconds) << ','
+            << number(summary.p90Seconds) << ','
+            << number(summary.p99Seconds) << ','
+            << summary.evaluations << ','
+            << number(summary.evaluationsPerSecond) << ','
+            << summary.partialEvaluations << '\n';
+    }
+}
+
+void write_json(ostream& out, const ExperimentMatrix& matrix, const vector<RunRecord>& records,
+                const vector<RunSummary>& summaries) {
+    out << "{\n  \"runs\": [";
+    for (size_t r = 0; r < records.size(); ++r) {
+        const RunRecord& record = records[r];
+        const RunSpec& s = record.spec;
+        const FlatInstance& instance = matrix.instances[s.instance];
+        const ParamSet& params = matrix.configs[s.algorithm][s.config];
+        const Budget& budget = matrix.budgets[s.budget];
+
+        out << (r ? ",\n" : "\n") << "    {\"algorithm\": " << json_string(matrix.algorithms[s.algorithm])
+            << ", \"config\": " << json_string(params.label) << ", \"params\": {";
+        for (size_t i = 0; i < params.values.size(); ++i) {
+            out << (i ? ", " : "") << json_string(params.values[i].first) << ": " << number(params.values[i].second);
+        }
+        out << "}, \"instance\": " << json_string(instance.name)
+            << ", \"n\": " << instance.n << ", \"m\": " << instance.m
+            << ", \"seed\": " << s.seed
+            << ", \"budget\": " << json_string(budget.label)
+            << ", \"time_limit_ms\": " << number(budget.time_limit_ms(instance))
+            << ", \"makespan\": " << record.outcome.makespan;
+        if (record.reference > 0) {
+            out << ", \"reference\": " << record.reference
+                << ", \"reference_kind\": " << (record.bestFoundReference ? "\"best_found\"" : "\"upper_bound\"")
+                << ", \"rpd\": " << number(record.rpd);
+        } else {
+            out << ", \"reference\": null, \"reference_kind\": null, \"rpd\": null";
+        }
+        out << ", \"seconds\": " << number(record.seconds)
+            << ", \"evaluations\": " << record.outcome.evaluations
+            << ", \"evaluations_per_second\": " << number(per_second(record.outcome.evaluations, record.seconds))
+            << ", \"partial_evaluations\": " << record.outcome.partialEvaluations
+            << ", \"trace\": [";
+        for (size_t i = 0; i < record.outcome.trace.size(); ++i) {
+            const TracePoint& point = record.outcome.trace[i];
+            out << (i ? ", " : "") << "[" << point.elapsedNs << ", " << point.evaluations << ", " << point.makespan << "]";
+        }
+        out << "]";
+        if (PhaseProfile::enabled()) {
+            out << ", \"profile\": {";
+            bool first = true;
+            for (int p = 0; p < NUM_PHASES; ++p) {
+                Phase phase = static_cast<Phase>(p);
+                const PhaseStats& stats = record.outcome.profile[phase];
+                if (stats.calls == 0) continue;
+                out << (first ? "" : ", ") << json_string(phase_name(phase))
+                    << ": {\"seconds\": " << number(record.outcome.profile.seconds(phase))
+                    << ", \"calls\": " << stats.calls
+                    << ", \"full_evaluations\": " << stats.fullEvaluations
+                    << ", \"partial_evaluations\": " << stats.partialEvaluations
+                    << ", \"neighbours\": " << stats.neighbours << "}";
+                first = false;
+            }
+            out << "}";
+        }
+        out << ", \"sequence\": [" << sequence_text(record.outcome.sequence, ", ") << "]}";
+    }
+    out << "\n  ],\n  \"summary\": [";
+    for (size_t i = 0; i < summaries.size(); ++i) {
+        const RunSummary& summary = summaries[i];
+        out << (i ? ",\n" : "\n") << "    {\"algorithm\": " << json_string(matrix.algorithms[summary.algorithm])
+            << ", \"config\": " << json_string(matrix.configs[summary.algorithm][summary.config].label)
+            << ", \"budget\": " << json_string(matrix.budgets[summary.budget].label)
+            << ", \"instance\": " << (summary.instance < 0 ? "null" : json_string(summary_instance_name(matrix, summary)))
+            << ", \"runs\": " << summary.runs;
+        if (summary.instance >= 0) {
+            out << ", \"best_makespan\": " << summary.bestMakespan
+                << ", \"mean_makespan\": " << number(summary.meanMakespan);
+        }
+        out << ", \"rpd_runs\": " << summary.rpdRuns;
+        if (summary.rpdRuns > 0) {
+            out << ", \"mean_rpd\": " << number(summary.meanRpd)
+                << ", \"median_rpd\": " << number(summary.medianRpd)
+                << ", \"best_rpd\": " << number(summary.bestRpd)
+                << ", \"worst_rpd\": " << number(summary.worstRpd);
+        }
+        out << ", \"p50_seconds\": " << number(summary.p50Seconds)
+            << ", \"p90_seconds\": " << number(summary.p90Seconds)
+            << ", \"p99_seconds\": " << number(summary.p99Seconds)
+            << ", \"evaluations\": " << summary.evaluations
+            << ", \"evaluations_per_second\": " << number(summary.evaluationsPerSecond)
+            << ", \"partial_evaluations\": " << summary.partialEvaluations << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+void print_summary(ostream& out, const ExperimentMatrix& matrix, const vector<RunSummary>& summaries) {
+    out << left << setw(8) << "Alg" << setw(22) << "Config" << setw(10) << "Budget" << setw(14) << "Instancia"
+        << right << setw(6) << "Runs" << setw(9) << "Mejor" << setw(10) << "RPD med" << setw(10) << "RPD mdn"
+        << setw(10) << "RPD min" << setw(10) << "t p50" << setw(10) << "t p90" << setw(12) << "eval/s" << endl;
+    out << fixed;
+    for (const RunSummary& summary : summaries) {
+        string config = matrix.configs[summary.algorithm][summary.config].label;
+        if (config.size() > 21) config = config.substr(0, 18) + "...";
+        out << left << setw(8) << matrix.algorithms[summary.algorithm] << setw(22) << config
+            << setw(10) << matrix.budgets[summary.budget].label
+            << setw(14) << summary_instance_name(matrix, summary) << right
+            << setw(6) << summary.runs << setw(9)
+            << (summary.instance < 0 ? "-" : to_string(summary.bestMakespan)) << setprecision(2);
+        if (summary.rpdRuns > 0) {
+            out << setw(10) << summary.meanRpd << setw(10) << summary.medianRpd << setw(10) << summary.bestRpd;
+        } else {
+            out << setw(10) << "-" << setw(10) << "-" << setw(10) << "-";
+        }
+        out << setprecision(3) << setw(10) << summary.p50Seconds << setw(10) << summary.p90Seconds
+            << setprecision(0) << setw(12) << summary.evaluationsPerSecond << endl;
+    }
+    out.unsetf(ios::fixed);
+    out << setprecision(6);
+}
@@ -0,0 +1,120 @@
+#ifndef EXPERIMENT_H
+#define EXPERIMENT_H
+
+// Arnés de experimentos: ejecuta la matriz algoritmo x parámetros x instancia x semilla
+// x presupuesto y resume los resultados (RPD contra el makespan de referencia de cada
+// instancia, percentiles de tiempo y evaluaciones por segundo). Cada corrida queda en
+// su propia fila de CSV/JSON, en el mismo orden en que se generó la matriz.
+
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/FlatInstance.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Presupuesto de una corrida. Sin iteraciones ni tiempo se usa el de cada main
+// (iteraciones según n, o n * (m / 2) * 30 ms en IG e ILS).
+struct Budget {
+    std::string label;               // como se dio: default, iter=N, ms=X, rs=T
+    int iterations = 0;
+    double timeLimitMs = 0.0;        // tiempo fijo por corrida
+    double timeFactor = 0.0;         // n * (m / 2) * t ms, como en Ruiz y Stutzle (2007)
+
+    bool is_default() const { return iterations <= 0 && timeLimitMs <= 0.0 && timeFactor <= 0.0; }
+    // Límite de tiempo para la instancia (0 = sin límite)
+    double time_limit_ms(const FlatInstance& instance) const {
+        if (timeFactor > 0.0) return instance.n * (instance.m / 2.0) * timeFactor;
+        return timeLimitMs;
+    }
+};
+
+// Conjunto de parámetros de un algoritmo: pares (nombre del campo, valor)
+struct ParamSet {
+    std::string label;
+    std::vector<std::pair<std::string, double>> values;
+};
+
+// Una celda de la matriz; los índices apuntan a las listas de ExperimentMatrix
+struct RunSpec {
+    size_t algorithm = 0;
+    size_t config = 0;
+    size_t instance = 0;
+    size_t budget = 0;
+    unsigned int seed = 0;
+};
+
+// Lo que devuelve el adaptador de cada algoritmo
+struct RunOutcome {
+    std::vector<int> sequence;
+    int makespan = 0;
+    long long evaluations = 0;         // makespans de secuencias completas
+    long long partialEvaluations = 0;  // posiciones de inserción de Taillard (IG e ILS)
+    std::vector<TracePoint> trace;   // cada mejora de la mejor solución, en orden
+    PhaseProfile profile;            // por fase; vacío salvo con make PROFILE=1
+};
+
+struct RunRecord {
+    RunSpec spec;
+    RunOutcome outcome;
+    double seconds = 0.0;
+    int reference = 0;               // makespan de referencia (0 = no hay)
+    bool bestFoundReference = false; // la referencia es el mejor makespan del experimento
+    double rpd = 0.0;                // 100 * (makespan - referencia) / referencia
+};
+
+struct ExperimentMatrix {
+    std::vector<std::string> algorithms;
+    std::vector<std::vector<ParamSet>> configs;  // por algoritmo
+    std::vector<FlatInstance> instances;
+    std::vector<unsigned int> seeds;
+    std::vector<Budget> budgets;
+
+    // Corridas en orden: instancia, algoritmo, configuración, presupuesto, semilla
+    std::vector<RunSpec> runs() const;
+};
+
+// Resumen de un grupo de corridas (algoritmo, configuración, presupuesto y una
+// instancia, o todas si instance < 0)
+struct RunSummary {
+    size_t algorithm = 0;
+    size_t config = 0;
+    size_t budget = 0;
+    long instance = -1;
+    int runs = 0;
+    int bestMakespan = 0;            // solo tienen sentido por instancia
+    double meanMakespan = 0.0;
+    int rpdRuns = 0;                 // corridas con referencia
+    double meanRpd = 0.0;
+    double medianRpd = 0.0;
+    double bestRpd = 0.0;
+    double worstRpd = 0.0;
+    double p50Seconds = 0.0;
+    double p90Seconds = 0.0;
+    double p99Seconds = 0.0;
+    long long evaluations = 0;
+    long long partialEvaluations = 0;
+    double evaluationsPerSecond = 0.0;   // solo evaluaciones completas
+};
+
+// Percentil por rango más cercano (p en [0, 100]) de valores ya ordenados
+double percentile(const std::vector<double>& sorted, double p);
+double median(const std::vector<double>& sorted);
+
+// Fija la referencia y el RPD de cada corrida: la cota superior de la instancia o,
+// si no tiene, el mejor makespan que alcanzó alguna corrida sobre ella
+void assign_references(const ExperimentMatrix& matrix, std::vector<RunRecord>& records);
+
+// Un resumen por instancia y, con más de una instancia, uno global por cada
+// (algoritmo, configuración, presupuesto)
+std::vector<RunSummary> summarize(const ExperimentMatrix& matrix, const std::vector<RunRecord>& records);
+
+void write_runs_csv(std::ostream& out, const ExperimentMatrix& matrix, const std::vector<RunRecord>& records);
+void write_summary_csv(std::ostream& out, const ExperimentMatrix& matrix, const std::vector<RunSummary>& summaries);
+void write_json(std::ostream& out, const ExperimentMatrix& matrix, const std::vector<RunRecord>& records,
+                const std::vector<RunSummary>& summaries);
+void print_summary(std::ostream& out, const ExperimentMatrix& matrix, const std::vector<RunSummary>& summaries);
+
+#endif
@@ -0,0 +1,67 @@
+#include "Scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+
+vector<int> available_cpus() {
+    vector<int> cpus;
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+        }
+    }
+#endif
+    if (cpus.empty()) {
+        cpus.resize(max(1u, thread::hardware_concurrency()));
+        iota(cpus.begin(), cpus.end(), 0);
+    }
+    return cpus;
+}
+
+vector<size_t> longest_first(const vector<double>& costs) {
+    vector<size_t> order(costs.size());
+    iota(order.begin(), order.end(), 0);
+    stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return costs[a] > costs[b]; });
+    return order;
+}
+
+static void pin_to_cpu(int cpu) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+    (void)cpu;
+#endif
+}
+
+void run_jobs(const vector<size_t>& order, const SchedulerOptions& options,
+              const function<void(size_t job, int worker)>& task) {
+    vector<int> cpus = available_cpus();
+    int workers = options.jobs > 0 ? options.jobs : (int)cpus.size();
+    workers = max(1, min(workers, (int)order.size()));
+
+    // Cada hilo toma el siguiente trabajo de la lista hasta vaciarla
+    atomic<size_t> next(0);
+    auto worker = [&](int w) {
+        if (options.pinCpus) pin_to_cpu(cpus[w % cpus.size()]);
+        for (size_t i = next++; i < order.size(); i = next++) task(order[i], w);
+    };
+
+    vector<thread> threads;
+    for (int w = 0; w < workers; ++w) threads.emplace_back(worker, w);
+    for (auto& t : threads) t.join();
+}
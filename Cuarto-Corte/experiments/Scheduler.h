@@ -0,0 +1,29 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+// Reparte corridas independientes entre un grupo acotado de hilos. Los trabajos se
+// toman en el orden dado (el más costoso primero, para que el último en terminar no
+// sea una instancia grande) y cada hilo queda fijo a un CPU, así el tiempo de una
+// corrida no depende de que el sistema la mueva de núcleo. Cada trabajo escribe en su
+// propia posición de la salida, que sale igual sin importar el número de hilos.
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+struct SchedulerOptions {
+    int jobs = 0;           // hilos trabajadores (0 = uno por CPU disponible)
+    bool pinCpus = true;    // fijar cada hilo a un CPU (solo Linux)
+};
+
+// CPUs en los que el proceso puede correr (respeta taskset y los límites del contenedor)
+std::vector<int> available_cpus();
+
+// Índices de 0 a costs.size() - 1 del costo mayor al menor; los empates quedan en orden
+std::vector<size_t> longest_first(const std::vector<double>& costs);
+
+// Ejecuta task(trabajo, hilo) para cada trabajo de 'order' y espera a que terminen
+void run_jobs(const std::vector<size_t>& order, const SchedulerOptions& options,
+              const std::function<void(size_t job, int worker)>& task);
+
+#endif
@@ -0,0 +1,232 @@
+#include "Algorithms.h"
+#include "Experiment.h"
+#include "Scheduler.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+static void usage() {
+    cerr << "Uso: experiments [opciones] [instancias...]\n"
+         << "  --algorithms=ga,ma,...   algoritmos (ga ma ss aco pr_rg ig grasp ts ils; por defecto todos)\n"
+         << "  --configs=1,2|all|none   configuraciones predefinidas de cada algoritmo (all)\n"
+         << "  --params=ALG:k=v,k=v     configuración extra: la primera con esos campos cambiados\n"
+         << "  --seeds=1-5,9            semillas (1)\n"
+         << "  --budgets=default,iter=N,ms=X,rs=T\n"
+         << "                           presupuestos: el de cada main, N iteraciones, X ms\n"
+         << "                           o n * (m / 2) * T ms (default)\n"
+         << "  --csv=ARCHIVO            una fila por corrida\n"
+         << "  --summary-csv=ARCHIVO    resúmenes por instancia y globales\n"
+         << "  --json=ARCHIVO           corridas y resúmenes\n"
+         << "  --jobs=N                 corridas simultáneas (una por CPU disponible)\n"
+         << "  --no-pin                 no fijar cada hilo a un CPU\n"
+         << "Instancias: archivos, directorios o nombres ta001-ta120; sin ninguna, las de Instances.h\n";
+}
+
+static vector<string> split(const string& text, char separator) {
+    vector<string> items;
+    stringstream in(text);
+    string item;
+    while (getline(in, item, separator)) {
+        if (!item.empty()) items.push_back(item);
+    }
+    return items;
+}
+
+static bool parse_number(const string& text, double& value) {
+    char* end = nullptr;
+    value = strtod(text.c_str(), &end);
+    return !text.empty() && *end == '\0' && value >= 0.0;
+}
+
+static bool parse_seeds(const string& text, vector<unsigned int>& seeds) {
+    seeds.clear();
+    for (const string& item : split(text, ',')) {
+        size_t dash = item.find('-');
+        double first, last;
+        if (!parse_number(item.substr(0, dash), first)) return false;
+        last = first;
+        if (dash != string::npos && !parse_number(item.substr(dash + 1), last)) return false;
+        for (double s = first; s <= last; s += 1.0) seeds.push_back((unsigned int)s);
+    }
+    return !seeds.empty();
+}
+
+static bool parse_budget(const string& text, Budget& budget) {
+    budget = Budget();
+    budget.label = text;
+    if (text == "default") return true;
+    size_t eq = text.find('=');
+    if (eq == string::npos) return false;
+    string kind = text.substr(0, eq);
+    double value;
+    if (!parse_number(text.substr(eq + 1), value) || value <= 0.0) return false;
+    if (kind == "iter") budget.iterations = (int)value;
+    else if (kind == "ms") budget.timeLimitMs = value;
+    else if (kind == "rs") budget.timeFactor = value;
+    else return false;
+    return true;
+}
+
+int main(int argc, char** argv) {
+    string algorithmList, configList = "all", seedList = "1", budgetList = "default";
+    string csvPath, summaryPath, jsonPath;
+    vector<string> paramOverrides;
+    SchedulerOptions scheduler;
+
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg[0] != '-') continue;
+        size_t eq = arg.find('=');
+        string name = arg.substr(0, eq);
+        string value = eq == string::npos ? "" : arg.substr(eq + 1);
+        if (name == "--algorithms") algorithmList = value;
+        else if (name == "--configs") configList = value;
+        else if (name == "--params") paramOverrides.push_back(value);
+        else if (name == "--seeds") seedList = value;
+        else if (name == "--budgets") budgetList = value;
+        else if (name == "--csv") csvPath = value;
+        else if (name == "--summary-csv") summaryPath = value;
+        else if (name == "--json") jsonPath = value;
+        else if (name == "--jobs") scheduler.jobs = atoi(value.c_str());
+        else if (name == "--no-pin") scheduler.pinCpus = false;
+        else {
+            usage();
+            return 1;
+        }
+    }
+
+    ExperimentMatrix matrix;
+    if (!instances_from_args(argc, argv, matrix.instances)) return 1;
+
+    // Algoritmos y sus configuraciones
+    vector<const AlgorithmInfo*> algorithms;
+    if (algorithmList.empty()) {
+        for (const AlgorithmInfo& algorithm : registered_algorithms()) algorithms.push_back(&algorithm);
+    } else {
+        for (const string& name : split(algorithmList, ',')) {
+            const AlgorithmInfo* algorithm = find_algorithm(name);
+            if (!algorithm) {
+                cerr << "Algoritmo desconocido: " << name << endl;
+                return 1;
+            }
+            algorithms.push_back(algorithm);
+        }
+    }
+    vector<string> configLabels = split(configList, ',');
+    for (const AlgorithmInfo* algorithm : algorithms) {
+        vector<ParamSet> configs;
+        for (const ParamSet& preset : algorithm->presets) {
+            bool selected = configList == "all";
+            for (const string& label : configLabels) selected = selected || label == preset.label;
+            if (selected) configs.push_back(preset);
+        }
+        for (const string& text : paramOverrides) {
+            size_t colon = text.find(':');
+            if (colon == string::npos || find_algorithm(text.substr(0, colon)) == nullptr) {
+                cerr << "--params: se esperaba ALG:campo=valor,... y se recibió '" << text << "'" << endl;
+                return 1;
+            }
+            if (text.substr(0, colon) != algorithm->name) continue;
+            ParamSet custom;
+            string error;
+            if (!custom_param_set(*algorithm, text.substr(colon + 1), custom, error)) {
+                cerr << "--params: " << error << endl;
+                return 1;
+            }
+            configs.push_back(custom);
+        }
+        if (configs.empty()) continue;
+        matrix.algorithms.push_back(algorithm->name);
+        matrix.configs.push_back(configs);
+    }
+
+    if (!parse_seeds(seedList, matrix.seeds)) {
+        cerr << "--seeds inválido: " << seedList << endl;
+        return 1;
+    }
+    for (const string& text : split(budgetList, ',')) {
+        Budget budget;
+        if (!parse_budget(text, budget)) {
+            cerr << "Presupuesto inválido: " << text << endl;
+            return 1;
+        }
+        matrix.budgets.push_back(budget);
+    }
+
+    vector<RunSpec> specs = matrix.runs();
+    if (specs.empty()) {
+        cerr << "La matriz de experimentos está vacía" << endl;
+        return 1;
+    }
+    vector<int> cpus = available_cpus();
+    int workers = min(scheduler.jobs > 0 ? scheduler.jobs : (int)cpus.size(), (int)specs.size());
+    cout << "Corridas: " << specs.size() << " (" << matrix.instances.size() << " instancias, "
+         << matrix.algorithms.size() << " algoritmos, " << matrix.seeds.size() << " semillas, "
+         << matrix.budgets.size() << " presupuestos) en " << workers << " hilos" << endl;
+
+    // Las filas de tiempos se arman una vez por instancia, antes de repartir las corridas
+    vector<vector<vector<int>>> rows;
+    for (const FlatInstance& instance : matrix.instances) rows.push_back(instance.job_rows());
+
+    // Las corridas más grandes primero: el costo estimado es n * m
+    vector<double> costs;
+    for (const RunSpec& spec : specs) {
+        const FlatInstance& instance = matrix.instances[spec.instance];
+        costs.push_back((double)instance.n * instance.m);
+    }
+
+    vector<RunRecord> records(specs.size());
+    mutex outputMutex;
+    size_t finished = 0;
+    run_jobs(longest_first(costs), scheduler, [&](size_t r, int) {
+        const RunSpec& spec = specs[r];
+        const FlatInstance& instance = matrix.instances[spec.instance];
+        const AlgorithmInfo* algorithm = find_algorithm(matrix.algorithms[spec.algorithm]);
+        const ParamSet& params = matrix.configs[spec.algorithm][spec.config];
+
+        auto start = chrono::steady_clock::now();
+        RunOutcome outcome = algorithm->run(instance, rows[spec.instance], params, spec.seed,
+                                            matrix.budgets[spec.budget]);
+        chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+        // Cada corrida escribe su propia fila, en el orden de la matriz
+        records[r].spec = spec;
+        records[r].outcome = outcome;
+        records[r].seconds = elapsed.count();
+
+        lock_guard<mutex> lock(outputMutex);
+        cout << "  [" << ++finished << "/" << specs.size() << "] " << algorithm->name << " #" << params.label
+             << " " << instance.name << " semilla=" << spec.seed << " " << matrix.budgets[spec.budget].label
+             << ": " << outcome.makespan << " en " << elapsed.count() << " s" << endl;
+    });
+
+    assign_references(matrix, records);
+    vector<RunSummary> summaries = summarize(matrix, records);
+    cout << endl;
+    print_summary(cout, matrix, summaries);
+
+    auto write_file = [](const string& path, auto writer) {
+        if (path.empty()) return true;
+        ofstream out(path);
+        if (out) writer(out);
+        if (!out) {
+            cerr << path << ": no se pudo escribir" << endl;
+            return false;
+        }
+        return true;
+    };
+    bool ok = write_file(csvPath, [&](ostream& out) { write_runs_csv(out, matrix, records); });
+    ok = write_file(summaryPath, [&](ostream& out) { write_summary_csv(out, matrix, summaries); }) && ok;
+    ok = write_file(jsonPath, [&](ostream& out) { write_json(out, matrix, records, summaries); }) && ok;
+    return ok ? 0 : 1;
+}
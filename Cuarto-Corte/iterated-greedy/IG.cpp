@@ -0,0 +1,129 @@
+#include "IG.h"
+#include "../../Primer-Corte/LS.h"
+#include "../../Primer-Corte/NEH.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
+#include "../../Segundo-Corte/genetic-algorithm/Budget.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace std;
+
+// Temperatura constante de Ruiz y Stutzle (2007): T * (suma de tiempos) / (n * m * 10).
+static double constant_temperature(const InstanceAggregates& aggregates, double factor) {
+    return factor * static_cast<double>(aggregates.total_work) / (10.0 * aggregates.n * aggregates.m);
+}
+
+// Destruccion: extrae d trabajos al azar. Construccion: los reinserta uno a uno,
+// en el orden en que fueron extraidos, en su mejor posicion (insercion de Taillard).
+// Cada posicion probada es una evaluacion parcial.
+static int destruction_construction(vector<int>& seq,
+                                    const vector<vector<int>>& tiempos,
+                                    int m,
+                                    int d,
+                                    mt19937& rng,
+                                    long long& evaluations,
+                                    long long& partialEvaluations,
+                                    PhaseProfile& profile) {
+    vector<int> removed;
+    removed.reserve(d);
+    for (int r = 0; r < d && seq.size() > 1; ++r) {
+        uniform_int_distribution<int> dist(0, static_cast<int>(seq.size()) - 1);
+        int pos = dist(rng);
+        removed.push_back(seq[pos]);
+        seq.erase(seq.begin() + pos);
+    }
+
+    int ms = calcular_makespan(seq, tiempos, m);
+    evaluations++;
+    profile.count_full(1);
+    for (int job : removed) {
+        partialEvaluations += seq.size() + 1;
+        profile.count_partial(seq.size() + 1);
+        ms = insertar_mejor_posicion(seq, job, tiempos, m);
+    }
+    return ms;
+}
+
+IGResult run_iterated_greedy(const vector<vector<int>>& tiempos,
+                             int n,
+                             int m,
+                             const IGParams& params) {
+    mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
+
+    unique_ptr<InstanceAggregates> localAggregates;
+    const InstanceAggregates& aggregates = aggregates_or_build(params.aggregates, localAggregates, tiempos, n, m);
+
+    IGResult best;
+    best.trace.restart(budget.start());
+    vector<int> current = aggregates.neh_sequence();
+    int currentMs;
+    {
+        ScopedPhase phase(best.profile, Phase::Initialization);
+        if (params.localSearch) {
+            long long before = best.partialEvaluations;
+            current = local_search_insertion_taillard(current, tiempos, m, &best.partialEvaluations);
+            best.profile.count_partial(best.partialEvaluations - before);
+            best.profile.count_neighbours(best.partialEvaluations - before);
+        }
+        currentMs = calcular_makespan(current, tiempos, m);
+        best.evaluations++;
+        best.profile.count_full(1);
+    }
+
+    best.bestSequence = current;
+    best.bestMakespan = currentMs;
+    best.trace.record(best.partialEvaluations, best.bestMakespan);
+
+    double T = constant_temperature(aggregates, params.temperature);
+    int d = max(1, min(params.destructionSize, n - 1));
+    uniform_real_distribution<double> prob(0.0, 1.0);
+
+    int iter = 0;
+    while (!budget.exhausted(iter)) {
+        vector<int> candidate = current;
+        int ms;
+        {
+            ScopedPhase phase(best.profile, Phase::Construction);
+            ms = destruction_construction(candidate, tiempos, m, d, rng,
+                                          best.evaluations, best.partialEvaluations, best.profile);
+        }
+
+        if (params.localSearch) {
+            {
+                // Cada vecino de la busqueda local es una posicion de insercion de Taillard
+                ScopedPhase phase(best.profile, Phase::LocalSearch);
+                long long before = best.partialEvaluations;
+                candidate = local_search_insertion_taillard(move(candidate), tiempos, m, &best.partialEvaluations);
+                best.profile.count_partial(best.partialEvaluations - before);
+                best.profile.count_neighbours(best.partialEvaluations - before);
+            }
+            ScopedPhase phase(best.profile, Phase::Evaluation, &best.evaluations);
+            ms = calcular_makespan(candidate, tiempos, m);
+            best.evaluations++;
+        }
+
+        // Criterio de aceptacion tipo recocido con temperatura constante
+        if (ms < currentMs) {
+            current = move(candidate);
+            currentMs = ms;
+            if (currentMs < best.bestMakespan) {
+                best.bestMakespan = currentMs;
+                best.bestSequence = current;
+                best.trace.record(best.partialEvaluations, best.bestMakespan);
+            }
+        } else if (prob(rng) <= exp(-static_cast<double>(ms - currentMs) / T)) {
+            current = move(candidate);
+            currentMs = ms;
+        }
+
+        ++iter;
+    }
+
+    best.iterations = iter;
+    return best;
+}
@@ -0,0 +1,38 @@
+#ifndef IG_H
+#define IG_H
+
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
+#include <vector>
+
+class InstanceAggregates;
+
+struct IGParams {
+    int destructionSize = 4;
+    double temperature = 0.4;
+    double timeLimitMs = 0.0;
+    int iterations = 0;
+    bool localSearch = true;
+    unsigned int seed = 0;
+    // Agregados de la instancia (InstanceAggregates.h) si el llamador ya los tiene;
+    // si faltan se calculan en cada llamada
+    const InstanceAggregates* aggregates = nullptr;
+};
+
+struct IGResult {
+    std::vector<int> bestSequence;
+    int bestMakespan = 0;
+    int iterations = 0;
+    long long evaluations = 0;         // makespans de secuencias completas
+    long long partialEvaluations = 0;  // posiciones de insercion de Taillard
+    ConvergenceTrace trace;            // (tiempo, evaluaciones parciales, makespan) de cada mejora
+    PhaseProfile profile;              // tiempo y evaluaciones por fase (make PROFILE=1)
+};
+
+IGResult run_iterated_greedy(const std::vector<std::vector<int>>& tiempos,
+                             int n,
+                             int m,
+                             const IGParams& params);
+
+#endif
@@ -0,0 +1,58 @@
+#include "IG.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
+
+    // Limite de tiempo n * (m / 2) * t ms, como en Ruiz y Stutzle (2007)
+    vector<int> timeFactors = {30, 60};
+
+    for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
+        cout << "Instancia: " << instance.name
+             << " (n=" << instance.n
+             << ", m=" << instance.m
+             << ", seed=" << instance.seed << ")" << endl;
+
+        for (size_t cfg = 0; cfg < timeFactors.size(); ++cfg) {
+            IGParams p;
+            p.destructionSize = 4;
+            p.temperature = 0.4;
+            p.timeLimitMs = instance.n * (instance.m / 2.0) * timeFactors[cfg];
+            p.seed = static_cast<unsigned int>(instance.seed);
+            p.aggregates = &instance.aggregates();
+
+            auto start = chrono::high_resolution_clock::now();
+            IGResult result = run_iterated_greedy(tiempos, instance.n, instance.m, p);
+            auto end = chrono::high_resolution_clock::now();
+            chrono::duration<double> elapsed = end - start;
+
+            cout << "  Config IG #" << (cfg + 1)
+                 << ": d=" << p.destructionSize
+                 << ", T=" << p.temperature
+                 << ", t=" << timeFactors[cfg]
+                 << ", limite=" << p.timeLimitMs << " ms" << endl;
+
+            cout << "    Mejor makespan: " << result.bestMakespan << endl;
+            cout << "    Iteraciones: " << result.iterations << endl;
+            cout << "    Tiempo: " << elapsed.count() << " s" << endl;
+            cout << "    Mejor secuencia: ";
+            for (int job : result.bestSequence) {
+                cout << (job + 1) << " ";
+            }
+            cout << endl;
+        }
+
+        cout << "----------------------------------------" << endl;
+    }
+
+    return 0;
+}
@@ -1,5 +1,5 @@
 #include "pr_rg.h"
-#include "../../Segundo-Corte/genetic-algorithm/Instances.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 #include <chrono>
 #include <iostream>
@@ -7,23 +7,16 @@
 
 using namespace std;
 
-static int reference_makespan(const string& name) {
-    if (name == "pfsp_20x5") return 1278;
-    if (name == "pfsp_20x10") return 1582;
-    if (name == "pfsp_50x10") return 3037;
-    if (name == "pfsp_100x10") return 5776;
-    if (name == "pfsp_100x20") return 6330;
-    return 0;
-}
-
 static double gap_percent(int value, int reference) {
     if (reference == 0) return 0.0;
     return 100.0 * (static_cast<double>(value) - static_cast<double>(reference)) /
            static_cast<double>(reference);
 }
 
-int main() {
-    auto instances = get_taillard_benchmark_instances();
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
 
     vector<PRParams> configs;
 
@@ -70,7 +63,8 @@ int main() {
     }
 
     for (const auto& instance : instances) {
-        int reference = reference_makespan(instance.name);
+        vector<vector<int>> tiempos = instance.job_rows();
+        int reference = instance.upper_bound;
 
         cout << "Instancia: " << instance.name
              << " (n=" << instance.n
@@ -79,6 +73,7 @@ int main() {
 
         for (size_t cfg = 0; cfg < configs.size(); ++cfg) {
             PRParams p = configs[cfg];
+            p.aggregates = &instance.aggregates();
             if (instance.n <= 20) {
                 p.iterations = 220;
             } else if (instance.n <= 50) {
@@ -89,7 +84,7 @@ int main() {
             p.seed = static_cast<unsigned int>(instance.seed);
 
             auto start = chrono::high_resolution_clock::now();
-            PRResult result = run_rumor_propagation_pfsp(instance.tiempos, instance.n, instance.m, p);
+            PRResult result = run_rumor_propagation_pfsp(tiempos, instance.n, instance.m, p);
             auto end = chrono::high_resolution_clock::now();
             chrono::duration<double> elapsed = end - start;
 
@@ -1,10 +1,12 @@
 #include "pr_rg.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
 #include "../../Segundo-Corte/genetic-algorithm/Instances.h"
+#include "../../Segundo-Corte/genetic-algorithm/Budget.h"
 
 #include <algorithm>
-#include <chrono>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -33,47 +35,6 @@ static vector<int> make_random_permutation(int n, mt19937& rng) {
     return perm;
 }
 
-static vector<int> neh_sequence(const vector<vector<int>>& tiempos,
-                                int n,
-                                int m) {
-    vector<int> jobs(n);
-    iota(jobs.begin(), jobs.end(), 0);
-
-    vector<int> totals(n, 0);
-    for (int i = 0; i < n; ++i) {
-        for (int j = 0; j < m; ++j) {
-            totals[i] += tiempos[i][j];
-        }
-    }
-
-    sort(jobs.begin(), jobs.end(), [&](int a, int b) {
-        if (totals[a] != totals[b]) return totals[a] > totals[b];
-        return a < b;
-    });
-
-    vector<int> seq;
-    seq.reserve(n);
-
-    for (int job : jobs) {
-        int bestPos = 0;
-        int bestMs = numeric_limits<int>::max();
-
-        for (int pos = 0; pos <= static_cast<int>(seq.size()); ++pos) {
-            vector<int> candidate = seq;
-            candidate.insert(candidate.begin() + pos, job);
-            int ms = compute_makespan_pr(candidate, tiempos, m);
-            if (ms < bestMs) {
-                bestMs = ms;
-                bestPos = pos;
-            }
-        }
-
-        seq.insert(seq.begin() + bestPos, job);
-    }
-
-    return seq;
-}
-
 static void apply_random_insertion(vector<int>& seq, mt19937& rng) {
     int n = static_cast<int>(seq.size());
     if (n < 2) return;
@@ -102,11 +63,11 @@ static void apply_random_inversion(vector<int>& seq, mt19937& rng) {
     reverse(seq.begin() + i, seq.begin() + j + 1);
 }
 
-static vector<int> randomized_neh_sequence(const vector<vector<int>>& tiempos,
+// Perturbacion de la secuencia NEH de la instancia (calculada una sola vez)
+static vector<int> randomized_neh_sequence(const vector<int>& nehSeq,
                                            int n,
-                                           int m,
                                            mt19937& rng) {
-    vector<int> seq = neh_sequence(tiempos, n, m);
+    vector<int> seq = nehSeq;
     int perturbations = max(1, n / 10);
 
     uniform_real_distribution<double> prob(0.0, 1.0);
@@ -126,7 +87,9 @@ static vector<int> local_search_insertion_sampled(vector<int> seq,
                                                  int m,
                                                  int maxPasses,
                                                  int maxTrialsPerPass,
-                                                 mt19937& rng) {
+                                                 mt19937& rng,
+                                                 long long& evaluations,
+                                                 PhaseProfile& profile) {
     if (seq.size() < 2) return seq;
 
     int n = static_cast<int>(seq.size());
@@ -134,6 +97,7 @@ static vector<int> local_search_insertion_sampled(vector<int> seq,
 
     for (int pass = 0; pass < maxPasses; ++pass) {
         int currentMs = compute_makespan_pr(seq, tiempos, m);
+        evaluations++;
         bool improved = false;
 
         for (int trial = 0; trial < maxTrialsPerPass; ++trial) {
@@ -148,6 +112,8 @@ static vector<int> local_search_insertion_sampled(vector<int> seq,
             neighbor.insert(neighbor.begin() + j, job);
 
             int ms = compute_makespan_pr(neighbor, tiempos, m);
+            evaluations++;
+            profile.count_neighbours();
             if (ms < currentMs) {
                 seq = move(neighbor);
                 currentMs = ms;
@@ -207,14 +173,16 @@ static vector<int> guided_neighbor(const vector<int>& source,
     return child;
 }
 
-static vector<int> path_relink_best_of_path(const vector<int>& source,
-                                            const vector<int>& target,
-                                            const vector<vector<int>>& tiempos,
-                                            int m,
-                                            mt19937& rng) {
+vector<int> path_relink_best_of_path(const vector<int>& source,
+                                     const vector<int>& target,
+                                     const vector<vector<int>>& tiempos,
+                                     int m,
+                                     mt19937& rng,
+                                     long long& evaluations) {
     vector<int> current = source;
     vector<int> best = current;
     int bestMs = compute_makespan_pr(current, tiempos, m);
+    evaluations++;
 
     int n = static_cast<int>(current.size());
     if (n < 2) return best;
@@ -254,6 +222,7 @@ static vector<int> path_relink_best_of_path(const vector<int>& source,
         current.insert(current.begin() + insertPos, job);
 
         int ms = compute_makespan_pr(current, tiempos, m);
+        evaluations++;
         if (ms < bestMs) {
             bestMs = ms;
             best = current;
@@ -295,6 +264,9 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
                                     int m,
                                     const PRParams& params) {
     mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
+
+    long long evaluations = 0;
 
     int networkSize = max(4, params.networkSize);
     int eliteCount = max(1, min(params.eliteCount, networkSize - 1));
@@ -304,50 +276,62 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
     int localTrials = max(1, params.localSearchTrials);
     int relinkingPeriod = max(1, params.relinkingPeriod);
 
+    unique_ptr<InstanceAggregates> localAggregates;
+    const InstanceAggregates& aggregates = aggregates_or_build(params.aggregates, localAggregates, tiempos, n, m);
+
     vector<vector<int>> population;
     population.reserve(networkSize);
 
     vector<int> makespans(networkSize, 0);
     vector<int> stagnation(networkSize, 0);
 
-    for (int i = 0; i < networkSize; ++i) {
-        vector<int> seedSeq;
-        if (i < (networkSize * 3) / 4) {
-            seedSeq = randomized_neh_sequence(tiempos, n, m, rng);
-        } else {
-            seedSeq = make_random_permutation(n, rng);
-        }
-
-        seedSeq = local_search_insertion_sampled(move(seedSeq), tiempos, m,
-                                                 max(1, localPasses - 2),
-                                                 max(3, localTrials / 2),
-                                                 rng);
-        population.push_back(move(seedSeq));
-    }
-
     PRResult best;
+    best.trace.restart(budget.start());
     best.bestMakespan = numeric_limits<int>::max();
 
     auto evaluate = [&]() {
         for (int i = 0; i < networkSize; ++i) {
             makespans[i] = compute_makespan_pr(population[i], tiempos, m);
+            evaluations++;
             if (makespans[i] < best.bestMakespan) {
                 best.bestMakespan = makespans[i];
                 best.bestSequence = population[i];
+                best.trace.record(evaluations, best.bestMakespan);
             }
         }
     };
 
-    evaluate();
+    {
+        ScopedPhase phase(best.profile, Phase::Initialization, &evaluations);
+        for (int i = 0; i < networkSize; ++i) {
+            vector<int> seedSeq;
+            if (i < (networkSize * 3) / 4) {
+                seedSeq = randomized_neh_sequence(aggregates.neh_sequence(), n, rng);
+            } else {
+                seedSeq = make_random_permutation(n, rng);
+            }
+
+            seedSeq = local_search_insertion_sampled(move(seedSeq), tiempos, m,
+                                                     max(1, localPasses - 2),
+                                                     max(3, localTrials / 2),
+                                                     rng, evaluations, best.profile);
+            population.push_back(move(seedSeq));
+        }
+
+        evaluate();
+    }
 
     uniform_real_distribution<double> prob(0.0, 1.0);
 
-    for (int iter = 0; iter < params.iterations; ++iter) {
+    for (int iter = 0; !budget.exhausted(iter); ++iter) {
         vector<int> order(networkSize);
-        iota(order.begin(), order.end(), 0);
-        sort(order.begin(), order.end(), [&](int a, int b) {
-            return makespans[a] < makespans[b];
-        });
+        {
+            ScopedPhase phase(best.profile, Phase::Selection);
+            iota(order.begin(), order.end(), 0);
+            sort(order.begin(), order.end(), [&](int a, int b) {
+                return makespans[a] < makespans[b];
+            });
+        }
 
         int bestIndex = order.front();
         int referenceBand = max(eliteCount + 1, networkSize / 4);
@@ -358,13 +342,20 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
             int idx = order[rank];
             int refIdx = order[uniform_int_distribution<int>(0, referenceBand - 1)(rng)];
 
-            vector<int> candidate = guided_neighbor(population[idx], population[refIdx], rng);
+            vector<int> candidate;
+            {
+                ScopedPhase phase(best.profile, Phase::Recombination);
+                candidate = guided_neighbor(population[idx], population[refIdx], rng);
+            }
             if (prob(rng) < params.guidedRefinementProb) {
+                ScopedPhase phase(best.profile, Phase::LocalSearch, &evaluations);
                 candidate = local_search_insertion_sampled(move(candidate), tiempos, m,
-                                                           localPasses, localTrials, rng);
+                                                           localPasses, localTrials, rng, evaluations, best.profile);
             }
 
+            ScopedPhase phase(best.profile, Phase::Evaluation, &evaluations);
             int ms = compute_makespan_pr(candidate, tiempos, m);
+            evaluations++;
             if (ms < makespans[idx]) {
                 population[idx] = move(candidate);
                 makespans[idx] = ms;
@@ -376,6 +367,7 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
             if (makespans[idx] < best.bestMakespan) {
                 best.bestMakespan = makespans[idx];
                 best.bestSequence = population[idx];
+                best.trace.record(evaluations, best.bestMakespan);
                 bestIndex = idx;
             }
         }
@@ -385,16 +377,29 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
         iota(rouletteCandidates.begin(), rouletteCandidates.end(), 0);
 
         for (int o = 0; o < listenerCount; ++o) {
-            int idx = roulette_select(makespans, rouletteCandidates, rng);
-            int refIdx = (prob(rng) < 0.7) ? bestIndex
+            int idx, refIdx;
+            {
+                ScopedPhase phase(best.profile, Phase::Selection);
+                idx = roulette_select(makespans, rouletteCandidates, rng);
+                refIdx = (prob(rng) < 0.7) ? bestIndex
                                            : order[uniform_int_distribution<int>(0, referenceBand - 1)(rng)];
+            }
 
-            vector<int> candidate = guided_neighbor(population[idx], population[refIdx], rng);
-            candidate = local_search_insertion_sampled(move(candidate), tiempos, m,
-                                                       localPasses,
-                                                       localTrials, rng);
+            vector<int> candidate;
+            {
+                ScopedPhase phase(best.profile, Phase::Recombination);
+                candidate = guided_neighbor(population[idx], population[refIdx], rng);
+            }
+            {
+                ScopedPhase phase(best.profile, Phase::LocalSearch, &evaluations);
+                candidate = local_search_insertion_sampled(move(candidate), tiempos, m,
+                                                           localPasses,
+                                                           localTrials, rng, evaluations, best.profile);
+            }
 
+            ScopedPhase phase(best.profile, Phase::Evaluation, &evaluations);
             int ms = compute_makespan_pr(candidate, tiempos, m);
+            evaluations++;
             if (ms < makespans[idx]) {
                 population[idx] = move(candidate);
                 makespans[idx] = ms;
@@ -406,6 +411,7 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
             if (makespans[idx] < best.bestMakespan) {
                 best.bestMakespan = makespans[idx];
                 best.bestSequence = population[idx];
+                best.trace.record(evaluations, best.bestMakespan);
                 bestIndex = idx;
             }
         }
@@ -413,20 +419,23 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
         // Informantes exploradores: reinyectar diversidad cuando un rumor se estanca.
         for (int i = 0; i < networkSize; ++i) {
             if (stagnation[i] >= boredomLimit) {
+                ScopedPhase phase(best.profile, Phase::Restart, &evaluations);
                 if (prob(rng) < params.explorerRandomRate) {
                     population[i] = make_random_permutation(n, rng);
                 } else {
-                    population[i] = randomized_neh_sequence(tiempos, n, m, rng);
+                    population[i] = randomized_neh_sequence(aggregates.neh_sequence(), n, rng);
                 }
                 population[i] = local_search_insertion_sampled(move(population[i]), tiempos, m,
                                                                   max(1, localPasses - 2),
-                                                                  localTrials, rng);
+                                                                  localTrials, rng, evaluations, best.profile);
                 makespans[i] = compute_makespan_pr(population[i], tiempos, m);
+                evaluations++;
                 stagnation[i] = 0;
 
                 if (makespans[i] < best.bestMakespan) {
                     best.bestMakespan = makespans[i];
                     best.bestSequence = population[i];
+                    best.trace.record(evaluations, best.bestMakespan);
                     bestIndex = i;
                 }
             }
@@ -439,14 +448,23 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
                 referenceIdx = order[uniform_int_distribution<int>(1, referenceBand - 1)(rng)];
             }
 
-            vector<int> candidate = path_relink_best_of_path(population[bestIndex],
-                                                             population[referenceIdx],
-                                                             tiempos, m, rng);
-            candidate = local_search_insertion_sampled(move(candidate), tiempos, m,
-                                                       localPasses,
-                                                       localTrials, rng);
+            vector<int> candidate;
+            {
+                ScopedPhase phase(best.profile, Phase::PathRelinking, &evaluations);
+                candidate = path_relink_best_of_path(population[bestIndex],
+                                                     population[referenceIdx],
+                                                     tiempos, m, rng, evaluations);
+            }
+            {
+                ScopedPhase phase(best.profile, Phase::LocalSearch, &evaluations);
+                candidate = local_search_insertion_sampled(move(candidate), tiempos, m,
+                                                           localPasses,
+                                                           localTrials, rng, evaluations, best.profile);
+            }
 
+            ScopedPhase phase(best.profile, Phase::Evaluation, &evaluations);
             int ms = compute_makespan_pr(candidate, tiempos, m);
+            evaluations++;
             int worstIdx = order.back();
             if (ms < makespans[worstIdx]) {
                 population[worstIdx] = move(candidate);
@@ -457,10 +475,12 @@ PRResult run_rumor_propagation_pfsp(const vector<vector<int>>& tiempos,
             if (ms < best.bestMakespan) {
                 best.bestMakespan = ms;
                 best.bestSequence = population[worstIdx];
+                best.trace.record(evaluations, best.bestMakespan);
                 bestIndex = worstIdx;
             }
         }
     }
 
+    best.evaluations = evaluations;
     return best;
 }
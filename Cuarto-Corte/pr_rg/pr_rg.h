@@ -1,12 +1,19 @@
 #ifndef PR_RG_H
 #define PR_RG_H
 
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
+#include <random>
 #include <vector>
 using namespace std;
 
+class InstanceAggregates;
+
 struct PRParams {
     int networkSize = 90;
     int iterations = 0;
+    double timeLimitMs = 0.0;        // 0 = sin limite de tiempo
     int eliteCount = 3;
     int boredomLimit = 18;
     int localSearchPasses = 4;
@@ -16,11 +23,17 @@ struct PRParams {
     double explorerRandomRate = 0.35;
     double guidedRefinementProb = 0.85;
     unsigned int seed = 0;
+    // Agregados de la instancia (InstanceAggregates.h) si el llamador ya los tiene;
+    // si faltan se calculan en cada llamada
+    const InstanceAggregates* aggregates = nullptr;
 };
 
 struct PRResult {
     std::vector<int> bestSequence;
     int bestMakespan = 0;
+    long long evaluations = 0;       // secuencias completas evaluadas
+    ConvergenceTrace trace;          // (tiempo, evaluaciones, makespan) de cada mejora
+    PhaseProfile profile;            // tiempo y evaluaciones por fase (make PROFILE=1)
 };
 
 PRResult run_rumor_propagation_pfsp(const std::vector<std::vector<int>>& tiempos,
@@ -32,4 +45,13 @@ int compute_makespan_pr(const std::vector<int>& secuencia,
                         const std::vector<std::vector<int>>& tiempos,
                         int m);
 
+// Camino de 'source' a 'target' por inserciones; devuelve la mejor secuencia del
+// camino. Expuesto para los micro-benchmarks (Cuarto-Corte/benchmarks).
+std::vector<int> path_relink_best_of_path(const std::vector<int>& source,
+                                          const std::vector<int>& target,
+                                          const std::vector<std::vector<int>>& tiempos,
+                                          int m,
+                                          std::mt19937& rng,
+                                          long long& evaluations);
+
 #endif
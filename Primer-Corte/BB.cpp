@@ -0,0 +1,903 @@
+#include "BB.h"
+#include "BBSearch.h"
+#include "BBCheckpoint.h"
+#include "BBTelemetry.h"
+#include "NEH.h"
+#include "LS.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+// Función para calcular la matriz de tiempos de finalización para una secuencia parcial
+vector<vector<int>> calculate_partial_completion(const vector<int>& partial_seq,
+                                                 const vector<vector<int>>& processing_times) {
+    /*
+    Calcula la matriz de tiempos de finalización para una secuencia parcial de trabajos
+    en un Permutation Flow Shop.
+
+    Args:
+        partial_seq: Índices de trabajos ya secuenciados
+        processing_times: Matriz MxN de tiempos de procesamiento (M máquinas x N trabajos)
+
+    Returns:
+        Matriz de tiempos de finalización de tamaño M x len(partial_seq)
+    */
+
+    if (partial_seq.empty()) {
+        return vector<vector<int>>(processing_times.size(), vector<int>());
+    }
+
+    int num_machines = processing_times.size();
+    int num_jobs = partial_seq.size();
+    vector<vector<int>> C(num_machines, vector<int>(num_jobs, 0));
+
+    for (int j = 0; j < num_jobs; j++) {
+        int job = partial_seq[j];
+        for (int m = 0; m < num_machines; m++) {
+            if (j == 0 && m == 0) {
+                C[m][j] = processing_times[m][job];
+            } else if (j == 0) {
+                C[m][j] = C[m-1][j] + processing_times[m][job];
+            } else if (m == 0) {
+                C[m][j] = C[m][j-1] + processing_times[m][job];
+            } else {
+                C[m][j] = max(C[m-1][j], C[m][j-1]) + processing_times[m][job];
+            }
+        }
+    }
+
+    return C;
+}
+
+// Función para transponer una matriz
+vector<vector<int>> transpose_matrix(const vector<vector<int>>& matrix) {
+    if (matrix.empty()) return {};
+
+    int num_machines = matrix[0].size();
+    int num_jobs = matrix.size();
+
+    vector<vector<int>> transposed(num_machines, vector<int>(num_jobs, 0));
+
+    for (int i = 0; i < num_jobs; i++) {
+        for (int j = 0; j < num_machines; j++) {
+            transposed[j][i] = matrix[i][j];
+        }
+    }
+
+    return transposed;
+}
+
+BBParams::BBParams()
+    : bound(BoundKind::LB1),
+      johnson_pairs(JohnsonPairs::LastMachine) {}
+
+BBInstance make_bb_instance(const int* machine_major, int num_jobs, int num_machines,
+                            const InstanceAggregates& aggregates) {
+    BBInstance inst;
+    inst.num_machines = num_machines;
+    inst.num_jobs = num_jobs;
+    inst.p.assign(machine_major, machine_major + (size_t)num_machines * num_jobs);
+    inst.machine_work = aggregates.machine_total;
+    return inst;
+}
+
+vector<int> machine_major_matrix(const vector<vector<int>>& processing_times) {
+    int num_machines = processing_times.size();
+    int num_jobs = num_machines > 0 ? processing_times[0].size() : 0;
+    vector<int> flat((size_t)num_machines * num_jobs);
+    for (int m = 0; m < num_machines; m++) {
+        copy(processing_times[m].begin(), processing_times[m].begin() + num_jobs, &flat[(size_t)m * num_jobs]);
+    }
+    return flat;
+}
+
+int sequence_makespan(const int* machine_major, int num_jobs, int num_machines, const vector<int>& sequence) {
+    vector<int> C(num_machines, 0);
+    for (int job : sequence) {
+        int prev = 0;
+        for (int m = 0; m < num_machines; m++) {
+            prev = max(prev, C[m]) + machine_major[(size_t)m * num_jobs + job];
+            C[m] = prev;
+        }
+    }
+    return num_machines > 0 ? C[num_machines - 1] : 0;
+}
+
+// Matriz trabajos x máquinas de NEH y la búsqueda local
+static vector<vector<int>> job_rows(const BBInstance& inst) {
+    vector<vector<int>> tiempos(inst.num_jobs, vector<int>(inst.num_machines));
+    for (int j = 0; j < inst.num_jobs; j++) {
+        for (int m = 0; m < inst.num_machines; m++) tiempos[j][m] = inst.time(m, j);
+    }
+    return tiempos;
+}
+
+// Coloca el estado en el nodo dado por 'prefix' (fila d = prefix.size())
+void SearchState::load_prefix(const vector<int>& prefix) {
+    const int M = inst.num_machines;
+    const int d = prefix.size();
+    int* C = &completion[d * M];
+    int* R = &remaining[d * M];
+    fill(C, C + M, 0);
+    copy(inst.machine_work.begin(), inst.machine_work.end(), R);
+    scheduled.reset();
+    for (int i = 0; i < d; i++) {
+        int job = prefix[i];
+        int c = 0;
+        for (int m = 0; m < M; m++) {
+            c = max(c, C[m]) + inst.time(m, job);
+            C[m] = c;
+            R[m] -= inst.time(m, job);
+        }
+        sequence[i] = job;
+        scheduled.set(job);
+    }
+}
+
+void SearchState::report_dominance(BBResult& result) const {
+    if (!dominance) return;
+    result.dominance_lookups += dominance->lookups;
+    result.dominance_hits += dominance->hits;
+    result.dominance_prunes += dominance->prunes;
+    result.dominance_evictions += dominance->evictions;
+    result.dominance_bytes += dominance->memory_bytes();
+}
+
+void SearchState::mark_flushed() {
+    flushed_nodes = nodes;
+    flushed_expanded = expanded;
+    copy(bound_prunes, bound_prunes + BB_NUM_BOUNDS, flushed_prunes);
+    if (dominance) flushed_dominance = dominance->prunes;
+}
+
+void SearchState::flush_live() {
+    if (!live) return;
+    live->generated += nodes - flushed_nodes;
+    live->expanded += expanded - flushed_expanded;
+    flushed_nodes = nodes;
+    flushed_expanded = expanded;
+    for (int b = 0; b < BB_NUM_BOUNDS; b++) {
+        live->pruned[b] += bound_prunes[b] - flushed_prunes[b];
+        flushed_prunes[b] = bound_prunes[b];
+    }
+    if (dominance) {
+        live->dominance_prunes += dominance->prunes - flushed_dominance;
+        flushed_dominance = dominance->prunes;
+    }
+    live->raise_max_depth(max_depth);
+    live->lower_incumbent(best_makespan);
+}
+
+// Cotas fuertes y dominancia de un hijo que ya pasó la cota simple. C_child y R_child
+// (fila depth + 1) deben estar cargados. Deja 'job' sin marcar como fijado.
+static bool refine_child(SearchState& s, int depth, int job, bool strong, int& child_lb) {
+    const BBInstance& inst = s.inst;
+    const int M = inst.num_machines;
+    const int* C_child = &s.completion[(depth + 1) * M];
+    const int* R_child = &s.remaining[(depth + 1) * M];
+
+    if (strong) {
+        s.bound_evaluations[(int)BoundKind::LB1]++;
+        child_lb = max(child_lb, lb1_child(inst, s.minima[depth], C_child, R_child, job));
+        if (child_lb >= s.best_makespan) {
+            s.bound_prunes[(int)BoundKind::LB1]++;
+            return false;
+        }
+    }
+
+    s.scheduled.set(job);
+    bool alive = true;
+
+    if (strong && s.params.bound == BoundKind::Johnson) {
+        s.bound_evaluations[(int)BoundKind::Johnson]++;
+        child_lb = max(child_lb, johnson_child(inst, s.tables, s.minima[depth], C_child,
+                                               s.scheduled, job, s.best_makespan));
+        if (child_lb >= s.best_makespan) {
+            s.bound_prunes[(int)BoundKind::Johnson]++;
+            alive = false;
+        }
+    }
+
+    // Otro orden de los mismos trabajos fijados ya dejó las máquinas libres antes.
+    // Con un solo trabajo fijado no hay otros órdenes, y las hojas no se guardan.
+    if (alive && s.dominance && depth + 1 >= 2 && depth + 1 < s.inst.num_jobs &&
+        s.dominance->dominated_or_insert(s.scheduled, C_child, depth + 1)) {
+        alive = false;
+    }
+    s.scheduled.reset(job);
+    return alive;
+}
+
+/*
+Generación en lote. Con K candidatos, sus tiempos se copian a una matriz M x K y la
+columna de cada hijo se calcula máquina por máquina:
+    col[m][k] = max(col[m-1][k], C[m]) + p[m][k],   lb[k] = max_m col[m][k] + R[m] - p[m][k]
+El ciclo interno recorre k sobre arreglos contiguos sin dependencias entre candidatos,
+así que se vectoriza (max y suma de enteros empaquetados). La columna del padre y el
+trabajo restante se leen una vez por máquina para todos los hijos.
+*/
+int generate_children(SearchState& s, int depth) {
+    const BBInstance& inst = s.inst;
+    const int M = inst.num_machines;
+    const int N = inst.num_jobs;
+    const int* C = &s.completion[depth * M];
+    const int* R = &s.remaining[depth * M];
+
+    s.on_expand(depth);
+    // Las cotas fuertes solo tienen sentido si al hijo le quedan trabajos por fijar
+    bool strong = s.params.bound != BoundKind::Simple && depth + 1 < N;
+    if (strong) compute_minima(inst, s.tables, s.scheduled, s.minima[depth]);
+
+    int K = 0;
+    for (int job = 0; job < N; job++) {
+        if (!s.scheduled[job]) s.batch_jobs[K++] = job;
+    }
+    int* times = s.batch_times.data();
+    int* cols = s.batch_columns.data();
+    int* lbs = s.batch_bounds.data();
+    const int* jobs = s.batch_jobs.data();
+    for (int m = 0; m < M; m++) {
+        const int* row = &inst.p[m * N];
+        int* t = times + m * K;
+        for (int k = 0; k < K; k++) t[k] = row[jobs[k]];
+    }
+
+    fill(lbs, lbs + K, 0);
+    for (int m = 0; m < M; m++) {
+        const int* t = times + m * K;
+        const int* prev = m > 0 ? cols + (m - 1) * K : nullptr;
+        int* col = cols + m * K;
+        const int c_parent = C[m];
+        const int r_parent = R[m];
+        if (prev) {
+            for (int k = 0; k < K; k++) {
+                int c = max(prev[k], c_parent) + t[k];
+                col[k] = c;
+                lbs[k] = max(lbs[k], c + r_parent - t[k]);
+            }
+        } else {
+            for (int k = 0; k < K; k++) {
+                int c = c_parent + t[k];
+                col[k] = c;
+                lbs[k] = max(lbs[k], c + r_parent - t[k]);
+            }
+        }
+    }
+    s.nodes += K;
+    s.bound_evaluations[(int)BoundKind::Simple] += K;
+
+    // Podar por la cota simple y refinar los sobrevivientes
+    ChildBound* out = &s.children[depth * N];
+    int* C_child = &s.completion[(depth + 1) * M];
+    int* R_child = &s.remaining[(depth + 1) * M];
+    int count = 0;
+    for (int k = 0; k < K; k++) {
+        if (lbs[k] >= s.best_makespan) {
+            s.bound_prunes[(int)BoundKind::Simple]++;
+            continue;
+        }
+        for (int m = 0; m < M; m++) {
+            C_child[m] = cols[m * K + k];
+            R_child[m] = R[m] - times[m * K + k];
+        }
+        int child_lb = lbs[k];
+        if (!refine_child(s, depth, jobs[k], strong, child_lb)) continue;
+        out[count++] = {child_lb, jobs[k]};
+    }
+
+    // Primero los hijos de menor cota, para encontrar antes buenos incumbentes
+    sort(out, out + count, [](const ChildBound& a, const ChildBound& b) {
+        return a.lb != b.lb ? a.lb < b.lb : a.job < b.job;
+    });
+    return count;
+}
+
+void load_child(SearchState& s, int depth, int job) {
+    const BBInstance& inst = s.inst;
+    const int M = inst.num_machines;
+    const int* C = &s.completion[depth * M];
+    const int* R = &s.remaining[depth * M];
+    int* C_child = &s.completion[(depth + 1) * M];
+    int* R_child = &s.remaining[(depth + 1) * M];
+    int c = 0;
+    for (int m = 0; m < M; m++) {
+        int p = inst.time(m, job);
+        c = max(c, C[m]) + p;
+        C_child[m] = c;
+        R_child[m] = R[m] - p;
+    }
+    s.scheduled.set(job);
+    s.sequence[depth] = job;
+}
+
+// Función recursiva de exploración en Branch and Bound
+void explore(SearchState& s, int depth) {
+    const int M = s.inst.num_machines;
+    const int N = s.inst.num_jobs;
+
+    // En paralelo, otro hilo puede haber mejorado el incumbente
+    if (s.shared) {
+        s.best_makespan = min(s.best_makespan, s.shared->makespan.load(memory_order_relaxed));
+    }
+
+    // Si no quedan trabajos, hemos encontrado una secuencia completa
+    if (depth == N) {
+        int makespan = s.completion[depth * M + M - 1];
+        if (makespan < s.best_makespan) {
+            s.best_makespan = makespan;
+            s.best_sequence = s.sequence;
+            if (s.shared) s.shared->offer(makespan, s.sequence);
+        }
+        return;
+    }
+
+    // Explorar los hijos en orden ascendente de cota: en cuanto uno no mejora el
+    // incumbente, tampoco lo hacen los siguientes
+    int count = generate_children(s, depth);
+    const ChildBound* kids = &s.children[depth * N];
+    for (int i = 0; i < count; i++) {
+        if (kids[i].lb >= s.best_makespan) break;
+        load_child(s, depth, kids[i].job);
+        explore(s, depth + 1);
+        s.scheduled.reset(kids[i].job);
+    }
+}
+
+/*
+B&B paralelo con robo de trabajo. Cada hilo tiene una deque de subproblemas (prefijos
+de la secuencia). El dueño toma de atrás (el más profundo, como en DFS) y los demás
+roban de adelante (el más superficial, que suele ser el subárbol más grande). Los nodos
+con más de 'parallel_grain' trabajos sin fijar se expanden y sus hijos van a la deque;
+los demás se resuelven con la exploración recursiva secuencial.
+*/
+struct WorkerQueue {
+    mutex lock;
+    deque<vector<int>> nodes;
+};
+
+// Contadores de un hilo copiados en cada transición, para leerlos desde el punto de control
+struct WorkerProgress {
+    bool busy = false;           // si está resolviendo 'active'
+    vector<int> active;
+    long long nodes = 0;
+    long long bound_evaluations[BB_NUM_BOUNDS] = {0, 0, 0};
+    long long bound_prunes[BB_NUM_BOUNDS] = {0, 0, 0};
+};
+
+struct ParallelContext {
+    const BBInstance& inst;
+    const BBParams& params;
+    const BoundTables& tables;
+    SharedIncumbent& incumbent;
+    vector<WorkerQueue> queues;
+    vector<WorkerProgress> progress;
+    atomic<long long> pending;   // subproblemas en deques o en proceso
+
+    // Los hilos toman este candado compartido al mover subproblemas entre deques y
+    // 'active'; el punto de control lo toma exclusivo y ve una frontera consistente.
+    shared_mutex frontier_lock;
+
+    ParallelContext(const BBInstance& i, const BBParams& p, const BoundTables& t,
+                    SharedIncumbent& inc, int threads)
+        : inst(i), params(p), tables(t), incumbent(inc), queues(threads), progress(threads),
+          pending(0) {}
+};
+
+static bool take_subproblem(ParallelContext& ctx, int id, mt19937& rng,
+                            vector<int>& prefix, BBWorkerStats& stats) {
+    {
+        WorkerQueue& own = ctx.queues[id];
+        lock_guard<mutex> guard(own.lock);
+        if (!own.nodes.empty()) {
+            prefix = move(own.nodes.back());
+            own.nodes.pop_back();
+            return true;
+        }
+    }
+
+    int threads = ctx.queues.size();
+    int start = uniform_int_distribution<int>(0, threads - 1)(rng);
+    for (int k = 0; k < threads; k++) {
+        int victim = (start + k) % threads;
+        if (victim == id) continue;
+        WorkerQueue& other = ctx.queues[victim];
+        lock_guard<mutex> guard(other.lock);
+        if (!other.nodes.empty()) {
+            prefix = move(other.nodes.front());
+            other.nodes.pop_front();
+            stats.steals++;
+            return true;
+        }
+    }
+    return false;
+}
+
+static void publish_progress(WorkerProgress& progress, const SearchState& s) {
+    progress.nodes = s.nodes;
+    for (int b = 0; b < BB_NUM_BOUNDS; b++) {
+        progress.bound_evaluations[b] = s.bound_evaluations[b];
+        progress.bound_prunes[b] = s.bound_prunes[b];
+    }
+}
+
+static void parallel_worker(ParallelContext& ctx, int id, SearchState& s, BBWorkerStats& stats) {
+    const int N = ctx.inst.num_jobs;
+    const int grain = max(1, ctx.params.parallel_grain);
+    mt19937 rng(id + 1);
+    vector<int> prefix;
+    vector<int> children;
+    WorkerProgress& progress = ctx.progress[id];
+
+    while (ctx.pending.load() > 0) {
+        {
+            shared_lock<shared_mutex> frontier(ctx.frontier_lock);
+            if (!take_subproblem(ctx, id, rng, prefix, stats)) {
+                frontier.unlock();
+                this_thread::yield();
+                continue;
+            }
+            // Los contadores publicados quedan en los de antes de 'active': si el punto de
+            // control lo guarda para repetirlo, sus nodos no se cuentan dos veces
+            publish_progress(progress, s);
+            progress.active = prefix;
+            progress.busy = true;
+        }
+        stats.subproblems++;
+
+        int depth = prefix.size();
+        s.load_prefix(prefix);
+        children.clear();
+        if (N - depth <= grain) {
+            explore(s, depth);
+        } else {
+            s.best_makespan = min(s.best_makespan, ctx.incumbent.makespan.load(memory_order_relaxed));
+            int count = generate_children(s, depth);
+            const ChildBound* kids = &s.children[depth * N];
+            for (int i = 0; i < count; i++) children.push_back(kids[i].job);
+        }
+
+        shared_lock<shared_mutex> frontier(ctx.frontier_lock);
+        if (!children.empty()) {
+            // Se apilan en orden inverso para que el dueño tome primero el de menor cota
+            ctx.pending.fetch_add(children.size());
+            WorkerQueue& own = ctx.queues[id];
+            lock_guard<mutex> guard(own.lock);
+            for (int i = (int)children.size() - 1; i >= 0; i--) {
+                vector<int> child(prefix);
+                child.push_back(children[i]);
+                own.nodes.push_back(move(child));
+            }
+        }
+        progress.busy = false;
+        publish_progress(progress, s);
+        ctx.pending.fetch_sub(1);
+    }
+}
+
+// Copia consistente de la frontera, el incumbente y los contadores
+static void snapshot(ParallelContext& ctx, const BBCheckpoint& base, long long elapsed_ms,
+                     BBCheckpoint& out) {
+    out = base;
+    out.frontier.clear();
+    unique_lock<shared_mutex> frontier(ctx.frontier_lock);
+    for (size_t t = 0; t < ctx.queues.size(); t++) {
+        lock_guard<mutex> guard(ctx.queues[t].lock);
+        const WorkerProgress& p = ctx.progress[t];
+        // Cada deque en su orden (el dueño toma del final) y detrás el subproblema a medio
+        // resolver, que se guarda entero y es el primero que se repite al reanudar; sus
+        // nodos ya generados no entran en p.nodes, que se publicó al tomarlo
+        out.frontier.insert(out.frontier.end(), ctx.queues[t].nodes.begin(), ctx.queues[t].nodes.end());
+        if (p.busy) out.frontier.push_back(p.active);
+        out.nodes += p.nodes;
+        for (int b = 0; b < BB_NUM_BOUNDS; b++) {
+            out.bound_evaluations[b] += p.bound_evaluations[b];
+            out.bound_prunes[b] += p.bound_prunes[b];
+        }
+    }
+    {
+        lock_guard<mutex> guard(ctx.incumbent.lock);
+        out.best_makespan = ctx.incumbent.makespan.load();
+        out.best_sequence = ctx.incumbent.sequence;
+    }
+    out.elapsed_ms = base.elapsed_ms + elapsed_ms;
+}
+
+static void run_parallel(const BBInstance& inst, const BBParams& params, const BoundTables& tables,
+                         SearchState& root, BBResult& result, const BBCheckpoint& base) {
+    int threads = params.threads > 0 ? params.threads : (int)thread::hardware_concurrency();
+    threads = max(1, threads);
+
+    SharedIncumbent incumbent(root.best_makespan);
+    incumbent.sequence = root.best_sequence;
+    ParallelContext ctx(inst, params, tables, incumbent, threads);
+    // La frontera vuelve en el orden en que se guardó, con los hijos de menor cota al
+    // final: se retoma la búsqueda en profundidad donde quedó y no en orden lexicográfico,
+    // que llega más tarde a los buenos incumbentes y genera más nodos
+    const vector<vector<int>>& frontier = base.frontier;
+    ctx.queues[0].nodes.assign(frontier.begin(), frontier.end());
+    ctx.pending = frontier.size();
+
+    vector<unique_ptr<SearchState>> states;
+    result.workers.assign(threads, BBWorkerStats());
+    for (int t = 0; t < threads; t++) {
+        states.emplace_back(new SearchState(inst, params, tables));
+        states[t]->shared = &incumbent;
+        states[t]->live = root.live;
+        states[t]->best_makespan = root.best_makespan;
+        if (params.dominance_mb > 0) {
+            states[t]->enable_dominance(params.dominance_mb * 1024 * 1024 / threads);
+        }
+    }
+
+    vector<thread> pool;
+    for (int t = 0; t < threads; t++) {
+        pool.emplace_back(parallel_worker, ref(ctx), t, ref(*states[t]), ref(result.workers[t]));
+    }
+
+    // El hilo principal escribe los puntos de control mientras los demás buscan
+    auto start = chrono::steady_clock::now();
+    auto elapsed_ms = [&start]() {
+        return chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start).count();
+    };
+    BBCheckpoint checkpoint;
+    if (!params.checkpoint_file.empty()) {
+        auto interval = chrono::milliseconds((long long)(params.checkpoint_interval_s * 1000));
+        auto last = start;
+        while (ctx.pending.load() > 0) {
+            this_thread::sleep_for(chrono::milliseconds(20));
+            if (chrono::steady_clock::now() - last < interval) continue;
+            snapshot(ctx, base, elapsed_ms(), checkpoint);
+            if (write_checkpoint(params.checkpoint_file, checkpoint)) result.checkpoints_written++;
+            last = chrono::steady_clock::now();
+        }
+    }
+    for (thread& th : pool) th.join();
+
+    // Punto de control final con la frontera vacía: reanudar devuelve el resultado
+    if (!params.checkpoint_file.empty()) {
+        snapshot(ctx, base, elapsed_ms(), checkpoint);
+        if (write_checkpoint(params.checkpoint_file, checkpoint)) result.checkpoints_written++;
+    }
+
+    root.best_makespan = incumbent.makespan.load();
+    root.best_sequence = incumbent.sequence;
+    for (int t = 0; t < threads; t++) {
+        states[t]->flush_live();
+        states[t]->report_dominance(result);
+        result.workers[t].nodes = states[t]->nodes;
+        root.nodes += states[t]->nodes;
+        root.expanded += states[t]->expanded;
+        root.max_depth = max(root.max_depth, states[t]->max_depth);
+        for (int b = 0; b < BB_NUM_BOUNDS; b++) {
+            root.bound_evaluations[b] += states[t]->bound_evaluations[b];
+            root.bound_prunes[b] += states[t]->bound_prunes[b];
+        }
+    }
+    // Los hilos ya volcaron sus contadores en las estadísticas en vivo
+    root.mark_flushed();
+}
+
+static bool is_job_permutation(const vector<int>& sequence, int num_jobs) {
+    if ((int)sequence.size() != num_jobs) return false;
+    vector<bool> seen(num_jobs, false);
+    for (int job : sequence) {
+        if (job < 0 || job >= num_jobs || seen[job]) return false;
+        seen[job] = true;
+    }
+    return true;
+}
+
+// Función principal de Branch and Bound
+BBResult branch_and_bound(const vector<vector<int>>& processing_times,
+                          const BBParams& params) {
+    /*
+    Resuelve el problema PFSP usando Branch and Bound exacto.
+
+    Args:
+        processing_times: Matriz MxN de tiempos de procesamiento
+        params: cota inferior y opciones de la búsqueda
+
+    Returns:
+        BBResult con la mejor secuencia, su makespan y el número de nodos generados
+    */
+    int num_machines = processing_times.size();
+    int num_jobs = num_machines > 0 ? processing_times[0].size() : 0;
+    vector<int> flat = machine_major_matrix(processing_times);
+    return branch_and_bound(flat.data(), num_jobs, num_machines, params);
+}
+
+BBResult branch_and_bound(const int* machine_major, int num_jobs, int num_machines, const BBParams& params) {
+    // Fijar solo hacia atrás es la búsqueda hacia adelante sobre la instancia invertida
+    if (params.direction == BranchDirection::Backward) {
+        vector<int> reversed((size_t)num_machines * num_jobs);
+        for (int m = 0; m < num_machines; m++) {
+            copy(machine_major + (size_t)(num_machines - 1 - m) * num_jobs,
+                 machine_major + (size_t)(num_machines - m) * num_jobs, &reversed[(size_t)m * num_jobs]);
+        }
+        BBParams forward = params;
+        forward.direction = BranchDirection::Forward;
+        forward.aggregates = nullptr;    // son de la instancia sin invertir
+        reverse(forward.initial_sequence.begin(), forward.initial_sequence.end());
+        BBResult result = branch_and_bound(reversed.data(), num_jobs, num_machines, forward);
+        reverse(result.sequence.begin(), result.sequence.end());
+        return result;
+    }
+
+    BBResult result;
+    if (num_jobs > BB_MAX_JOBS) {
+        cerr << "Branch and Bound: como máximo " << BB_MAX_JOBS << " trabajos" << endl;
+        return result;
+    }
+
+    unique_ptr<InstanceAggregates> local_aggregates;
+    const InstanceAggregates& aggregates = aggregates_or_build(params.aggregates, local_aggregates, machine_major,
+                                                               num_jobs, num_machines, MatrixLayout::MachineMajor);
+    BBInstance inst = make_bb_instance(machine_major, num_jobs, num_machines, aggregates);
+
+    BoundTables tables = make_bound_tables(inst, aggregates, params.bound, params.johnson_pairs);
+    SearchState state(inst, params, tables);
+    copy(inst.machine_work.begin(), inst.machine_work.end(), state.remaining.begin());
+
+    // Incumbente inicial: así la poda funciona desde el primer nodo
+    if (params.upper_bound != INT_MAX) {
+        state.best_makespan = params.upper_bound + 1;
+    }
+    if (!params.initial_sequence.empty() && !is_job_permutation(params.initial_sequence, inst.num_jobs)) {
+        cerr << "Branch and Bound: la secuencia inicial no es una permutación de los trabajos, se ignora" << endl;
+    } else if (!params.initial_sequence.empty()) {
+        int makespan = sequence_makespan(inst.p.data(), inst.num_jobs, inst.num_machines, params.initial_sequence);
+        if (makespan < state.best_makespan) {
+            state.best_makespan = makespan;
+            state.best_sequence = params.initial_sequence;
+        }
+    }
+    if (params.neh_incumbent && inst.num_jobs > 0) {
+        vector<int> secuencia = aggregates.neh_sequence();
+        int makespan = aggregates.neh_makespan();
+        if (params.local_search) {
+            secuencia = local_search_insertion_taillard(secuencia, job_rows(inst), inst.num_machines);
+            makespan = sequence_makespan(inst.p.data(), inst.num_jobs, inst.num_machines, secuencia);
+        }
+        if (makespan < state.best_makespan) {
+            state.best_makespan = makespan;
+            state.best_sequence = secuencia;
+        }
+    }
+    result.initial_upper_bound = state.best_sequence.empty() ? params.upper_bound : state.best_makespan;
+
+    // Frontera inicial: la raíz, o la del punto de control al reanudar
+    BBCheckpoint base;
+    base.num_jobs = inst.num_jobs;
+    base.num_machines = inst.num_machines;
+    base.checksum = instance_checksum(inst);
+    base.bound_evaluations.assign(BB_NUM_BOUNDS, 0);
+    base.bound_prunes.assign(BB_NUM_BOUNDS, 0);
+    base.frontier.push_back(vector<int>());
+    if (params.resume) {
+        BBCheckpoint loaded;
+        if (!read_checkpoint(params.checkpoint_file, loaded)) return result;
+        if (loaded.num_jobs != base.num_jobs || loaded.num_machines != base.num_machines ||
+            loaded.checksum != base.checksum) {
+            cerr << "Branch and Bound: el punto de control es de otra instancia" << endl;
+            return result;
+        }
+        base = loaded;
+        if (is_job_permutation(loaded.best_sequence, inst.num_jobs)) {
+            if (loaded.best_makespan < state.best_makespan) {
+                state.best_makespan = loaded.best_makespan;
+                state.best_sequence = loaded.best_sequence;
+            }
+        } else if (loaded.best_sequence.empty()) {
+            state.best_makespan = min(state.best_makespan, (int)loaded.best_makespan);
+        }
+        result.resumed_subproblems = loaded.frontier.size();
+    }
+
+    // Los puntos de control usan el motor con deques (también con un solo hilo)
+    bool use_frontier = params.threads != 1 || !params.checkpoint_file.empty();
+    if (use_frontier && (params.direction != BranchDirection::Forward || params.strategy != BBStrategy::DepthFirst)) {
+        cerr << "Branch and Bound: hilos y puntos de control solo con la búsqueda en profundidad"
+             << " hacia adelante; se ignoran" << endl;
+        use_frontier = false;
+    }
+
+    bool anytime = params.strategy == BBStrategy::Beam || params.strategy == BBStrategy::LimitedDiscrepancy;
+    bool sequential = params.strategy == BBStrategy::BestFirst || !use_frontier;
+    if (params.dominance_mb > 0 && params.direction == BranchDirection::Forward && sequential && !anytime) {
+        state.enable_dominance(params.dominance_mb * 1024 * 1024);
+    }
+
+    // Estadísticas en vivo (el hilo de reporte solo corre si stats_interval_s > 0)
+    BBLiveStats live(state.best_makespan, aggregates.lower_bound);
+    live.generated = base.nodes;
+    state.live = &live;
+    TelemetryReporter reporter(inst, params, tables, live);
+
+    // Iniciar exploración
+    if (anytime) {
+        run_anytime(params, state, result);
+    } else if (params.direction != BranchDirection::Forward) {
+        run_bidirectional(inst, params, tables, state);
+    } else if (params.strategy == BBStrategy::BestFirst) {
+        run_best_first(inst, params, state, result);
+    } else if (!use_frontier) {
+        explore(state, 0);
+    } else {
+        run_parallel(inst, params, tables, state, result, base);
+    }
+
+    // Búsqueda exacta terminada: el incumbente es óptimo y la cota lo alcanza
+    state.flush_live();
+    if (!anytime && !state.best_sequence.empty()) live.raise_lower_bound(state.best_makespan);
+    result.telemetry = reporter.finish();
+    if (!params.stats_json.empty()) write_telemetry_json(params.stats_json, result.telemetry);
+
+    result.sequence = state.best_sequence;
+    result.makespan = state.best_sequence.empty() ? 0 : state.best_makespan;
+    result.nodes = state.nodes + base.nodes;
+    result.bound_evaluations.assign(state.bound_evaluations, state.bound_evaluations + BB_NUM_BOUNDS);
+    result.bound_prunes.assign(state.bound_prunes, state.bound_prunes + BB_NUM_BOUNDS);
+    for (int b = 0; b < BB_NUM_BOUNDS; b++) {
+        result.bound_evaluations[b] += base.bound_evaluations[b];
+        result.bound_prunes[b] += base.bound_prunes[b];
+    }
+    state.report_dominance(result);
+    result.forward_branchings = state.forward_branchings;
+    result.backward_branchings = state.backward_branchings;
+    return result;
+}
+
+static void print_bb_usage(const char* program) {
+    cerr << "Uso: " << program << " [INSTANCIAS...] [--bound=simple|lb1|johnson] [--pairs=adjacent|last|all]"
+         << " [--no-neh] [--no-ls] [--ub=N] [--threads=N] [--grain=N]"
+         << " [--strategy=dfs|best|beam|lds] [--memory-mb=N]"
+         << " [--beam=W] [--idle-weight=X] [--discrepancies=D]"
+         << " [--direction=forward|backward|alternate|fewest|bound]"
+         << " [--tt-mb=N] [--tt-evict=deepest|lru|roundrobin]"
+         << " [--checkpoint=ARCHIVO] [--checkpoint-every=SEG] [--resume]"
+         << " [--stats-every=SEG] [--stats-json=ARCHIVO]" << endl;
+}
+
+bool parse_bb_args(int argc, char** argv, BBParams& params, vector<string>* instance_paths) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (instance_paths && !arg.empty() && arg[0] != '-') {
+            instance_paths->push_back(arg);
+        } else if (arg.rfind("--bound=", 0) == 0) {
+            string value = arg.substr(8);
+            if (value == "simple") params.bound = BoundKind::Simple;
+            else if (value == "lb1") params.bound = BoundKind::LB1;
+            else if (value == "johnson") params.bound = BoundKind::Johnson;
+            else { print_bb_usage(argv[0]); return false; }
+        } else if (arg.rfind("--pairs=", 0) == 0) {
+            string value = arg.substr(8);
+            if (value == "adjacent") params.johnson_pairs = JohnsonPairs::Adjacent;
+            else if (value == "last") params.johnson_pairs = JohnsonPairs::LastMachine;
+            else if (value == "all") params.johnson_pairs = JohnsonPairs::All;
+            else { print_bb_usage(argv[0]); return false; }
+        } else if (arg.rfind("--strategy=", 0) == 0) {
+            string value = arg.substr(11);
+            if (value == "dfs") params.strategy = BBStrategy::DepthFirst;
+            else if (value == "best") params.strategy = BBStrategy::BestFirst;
+            else if (value == "beam") params.strategy = BBStrategy::Beam;
+            else if (value == "lds") params.strategy = BBStrategy::LimitedDiscrepancy;
+            else { print_bb_usage(argv[0]); return false; }
+        } else if (arg.rfind("--direction=", 0) == 0) {
+            string value = arg.substr(12);
+            if (value == "forward") params.direction = BranchDirection::Forward;
+            else if (value == "backward") params.direction = BranchDirection::Backward;
+            else if (value == "alternate") params.direction = BranchDirection::Alternate;
+            else if (value == "fewest") params.direction = BranchDirection::FewestChildren;
+            else if (value == "bound") params.direction = BranchDirection::BestBound;
+            else { print_bb_usage(argv[0]); return false; }
+        } else if (arg.rfind("--tt-evict=", 0) == 0) {
+            string value = arg.substr(11);
+            if (value == "deepest") params.dominance_eviction = TTEviction::Deepest;
+            else if (value == "lru") params.dominance_eviction = TTEviction::LeastRecentlyUsed;
+            else if (value == "roundrobin") params.dominance_eviction = TTEviction::RoundRobin;
+            else { print_bb_usage(argv[0]); return false; }
+        } else if (arg.rfind("--checkpoint=", 0) == 0) {
+            params.checkpoint_file = arg.substr(13);
+        } else if (arg.rfind("--stats-json=", 0) == 0) {
+            params.stats_json = arg.substr(13);
+        } else if (arg.rfind("--idle-weight=", 0) == 0) {
+            try {
+                params.idle_weight = stod(arg.substr(14));
+            } catch (const exception&) {
+                print_bb_usage(argv[0]);
+                return false;
+            }
+        } else if (arg == "--resume") {
+            params.resume = true;
+        } else if (arg == "--no-neh") {
+            params.neh_incumbent = false;
+        } else if (arg == "--no-ls") {
+            params.local_search = false;
+        } else if (arg.find('=') != string::npos) {
+            // Opciones numéricas: --nombre=N
+            string name = arg.substr(0, arg.find('='));
+            int value;
+            try {
+                value = stoi(arg.substr(arg.find('=') + 1));
+            } catch (const exception&) {
+                print_bb_usage(argv[0]);
+                return false;
+            }
+            if (name == "--ub") params.upper_bound = value;
+            else if (name == "--threads") params.threads = value;
+            else if (name == "--grain") params.parallel_grain = value;
+            else if (name == "--memory-mb") params.memory_limit_mb = max(0, value);
+            else if (name == "--tt-mb") params.dominance_mb = max(0, value);
+            else if (name == "--checkpoint-every") params.checkpoint_interval_s = max(1, value);
+            else if (name == "--stats-every") params.stats_interval_s = max(0, value);
+            else if (name == "--beam") params.beam_width = max(1, value);
+            else if (name == "--discrepancies") params.discrepancies = max(0, value);
+            else { print_bb_usage(argv[0]); return false; }
+        } else {
+            print_bb_usage(argv[0]);
+            return false;
+        }
+    }
+    if (params.resume && params.checkpoint_file.empty()) {
+        cerr << "--resume necesita --checkpoint=ARCHIVO" << endl;
+        return false;
+    }
+    return true;
+}
+
+void print_bb_stats(const BBResult& result) {
+    if (result.initial_upper_bound != INT_MAX) {
+        cout << "Cota superior inicial: " << result.initial_upper_bound << endl;
+    }
+    cout << "Nodos generados: " << result.nodes << endl;
+    for (int b = 0; b < (int)result.bound_evaluations.size(); b++) {
+        if (result.bound_evaluations[b] == 0) continue;
+        cout << "  Cota " << bound_name((BoundKind)b)
+             << ": evaluada " << result.bound_evaluations[b]
+             << " veces, podó " << result.bound_prunes[b] << " nodos" << endl;
+    }
+    if (result.node_bytes > 0) {
+        cout << "  Primero el mejor: " << result.max_open_nodes << " nodos abiertos como máximo ("
+             << result.node_bytes << " bytes c/u), " << result.peak_memory_bytes / 1024
+             << " KB de memoria pico, " << result.dfs_dives << " inmersiones en profundidad" << endl;
+    }
+    if (result.resumed_subproblems > 0) {
+        cout << "  Reanudado con " << result.resumed_subproblems << " subproblemas abiertos" << endl;
+    }
+    if (result.checkpoints_written > 0) {
+        cout << "  Puntos de control escritos: " << result.checkpoints_written << endl;
+    }
+    if (result.dominance_lookups > 0) {
+        cout << "  Dominancia: " << result.dominance_lookups << " consultas, "
+             << result.dominance_hits << " aciertos, podó " << result.dominance_prunes
+             << " nodos, " << result.dominance_evictions << " desalojos ("
+             << result.dominance_bytes / (1024 * 1024) << " MB)" << endl;
+    }
+    if (result.forward_branchings + result.backward_branchings > 0) {
+        cout << "  Ramificación: " << result.forward_branchings << " nodos hacia adelante, "
+             << result.backward_branchings << " hacia atrás" << endl;
+    }
+    for (const BBAnytimeStep& step : result.anytime) {
+        cout << "  Anytime " << step.level << ": makespan " << step.makespan << ", "
+             << step.nodes << " nodos, " << step.elapsed_s << " s" << endl;
+    }
+    for (int t = 0; t < (int)result.workers.size(); t++) {
+        const BBWorkerStats& w = result.workers[t];
+        cout << "  Hilo " << t << ": " << w.nodes << " nodos, " << w.subproblems
+             << " subproblemas, " << w.steals << " robados" << endl;
+    }
+}
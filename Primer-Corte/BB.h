@@ -0,0 +1,224 @@
+#ifndef BB_H
+#define BB_H
+
+#include <bitset>
+#include <climits>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Maximo numero de trabajos que admite la mascara de trabajos fijados
+const int BB_MAX_JOBS = 128;
+typedef std::bitset<BB_MAX_JOBS> JobMask;
+
+// Instancia en formato plano, maquina-mayor: p[m * num_jobs + j]
+struct BBInstance {
+    int num_machines = 0;
+    int num_jobs = 0;
+    std::vector<int> p;
+    std::vector<int> machine_work;   // suma de tiempos de cada maquina
+
+    int time(int machine, int job) const { return p[machine * num_jobs + job]; }
+};
+
+enum class BoundKind;
+enum class JohnsonPairs;
+class InstanceAggregates;
+
+// Estrategia de recorrido del árbol
+enum class BBStrategy {
+    DepthFirst,     // recursión en profundidad (secuencial o paralela)
+    BestFirst,      // menor cota primero, con inmersiones en profundidad al llegar al tope de memoria
+    // Modos anytime heurísticos: devuelven una solución completa enseguida y la
+    // mejoran al crecer el ancho o las discrepancias, sin demostrar optimalidad
+    Beam,               // los beam_width mejores nodos de cada nivel
+    LimitedDiscrepancy  // a lo sumo 'discrepancies' desvíos del hijo de menor cota
+};
+
+// Lado por el que se fijan trabajos
+enum class BranchDirection {
+    Forward,        // solo al final del prefijo (la búsqueda original)
+    Backward,       // solo al principio del sufijo: se resuelve la instancia invertida
+    Alternate,      // adelante y atrás alternando por profundidad
+    FewestChildren, // en cada nodo, el lado con menos hijos que sobreviven a la poda
+    BestBound       // en cada nodo, el lado cuyas cotas de hijos suman más
+};
+
+// Política de desalojo de la tabla de dominancia cuando un cubo está lleno
+enum class TTEviction {
+    Deepest,            // la entrada más profunda (la que cubre el subárbol más chico)
+    LeastRecentlyUsed,  // la usada hace más tiempo
+    RoundRobin          // por turnos, sin mirar la entrada
+};
+
+struct BBParams {
+    BoundKind bound;                 // cota inferior usada para podar (ver BBBounds.h)
+    JohnsonPairs johnson_pairs;      // pares de máquinas de la cota de Johnson
+
+    // Incumbente inicial: NEH, opcionalmente mejorado con búsqueda local de inserción
+    bool neh_incumbent = true;
+    bool local_search = true;
+
+    // Agregados de la instancia (../Segundo-Corte/genetic-algorithm/InstanceAggregates.h)
+    // si el llamador ya los tiene: de ahí salen la secuencia NEH y los órdenes de
+    // Johnson. Si faltan se calculan para esta búsqueda.
+    const InstanceAggregates* aggregates = nullptr;
+
+    // Cota superior externa. Si se da una secuencia se usa su makespan; si solo se da
+    // el valor, se buscan secuencias con makespan <= upper_bound (y si no existen, el
+    // resultado queda vacío).
+    int upper_bound = INT_MAX;
+    std::vector<int> initial_sequence;
+
+    // Búsqueda paralela con robo de trabajo (0 = todos los núcleos). Los nodos con
+    // más de parallel_grain trabajos sin fijar se reparten entre hilos; los demás
+    // los resuelve en profundidad el hilo que los toma.
+    int threads = 1;
+    int parallel_grain = 10;
+
+    // Primero el mejor es secuencial: ignora 'threads'
+    BBStrategy strategy = BBStrategy::DepthFirst;
+    std::size_t memory_limit_mb = 512;   // tope de la frontera en primero el mejor
+
+    // Modos anytime (ver BBAnytime.cpp). El haz se ordena por cota más idle_weight
+    // veces el tiempo ocioso medio por máquina que agrega el último trabajo, y se
+    // resuelve con anchos 1, 2, 4, ..., beam_width. Con discrepancias se repite la
+    // inmersión con 0, 1, ..., discrepancies; tomar el i-ésimo hijo cuesta i. Son
+    // secuenciales e ignoran 'threads', la dominancia y las direcciones dinámicas.
+    int beam_width = 16;
+    double idle_weight = 1.0;
+    int discrepancies = 2;
+
+    // Las direcciones dinámicas (Alternate, FewestChildren, BestBound) usan su propia
+    // búsqueda en profundidad secuencial, con la cota simple o LB1 (Johnson cuenta
+    // como LB1), e ignoran 'strategy' y 'threads'.
+    BranchDirection direction = BranchDirection::Forward;
+
+    // Tabla de dominancia por conjunto de trabajos fijados (0 = desactivada). En la
+    // búsqueda paralela cada hilo tiene su tabla y el tope se reparte entre ellos.
+    // No se usa con las direcciones dinámicas.
+    std::size_t dominance_mb = 16;
+    TTEviction dominance_eviction = TTEviction::Deepest;
+
+    // Punto de control periódico de la frontera, el incumbente y las estadísticas
+    // (ver BBCheckpoint.h). Usa el motor de deques de la búsqueda paralela aunque
+    // threads sea 1. Con resume se continúa desde checkpoint_file con los hilos
+    // que se indiquen, sin importar con cuántos se escribió.
+    std::string checkpoint_file;
+    double checkpoint_interval_s = 60;
+    bool resume = false;
+
+    // Estadísticas en vivo: cada cuántos segundos imprimirlas (0 = nunca), sondas de
+    // Knuth por reporte para estimar el árbol, y archivo JSON con las finales
+    double stats_interval_s = 0;
+    int stats_probes = 64;
+    std::string stats_json;
+
+    BBParams();
+};
+
+// Estadísticas de cada hilo de la búsqueda paralela
+struct BBWorkerStats {
+    long long nodes = 0;
+    long long subproblems = 0;       // subproblemas tomados de las deques
+    long long steals = 0;            // de ellos, robados a otro hilo
+};
+
+// Fotografía de las estadísticas de la búsqueda (ver BBTelemetry.h)
+struct BBTelemetry {
+    double elapsed_s = 0;
+    long long nodes_generated = 0;
+    long long nodes_expanded = 0;
+    std::vector<long long> pruned;       // por cota (índice BoundKind)
+    long long dominance_prunes = 0;
+    int max_depth = 0;
+    double nodes_per_s = 0;
+    int incumbent = INT_MAX;
+    int lower_bound = 0;                 // raíz en profundidad; mínimo de la frontera en primero el mejor
+    double gap = 1.0;                    // (incumbente - cota) / incumbente
+    double tree_size_estimate = 0;       // estimación de Knuth de los nodos generados
+    long long knuth_probes = 0;
+    double eta_s = -1;                   // tiempo restante según la estimación (-1 = sin estimación)
+};
+
+// Solución al terminar una iteración de un modo anytime
+struct BBAnytimeStep {
+    int level = 0;           // ancho del haz o número de discrepancias
+    int makespan = 0;        // mejor makespan hasta ese momento (0 si no hay)
+    long long nodes = 0;     // nodos generados acumulados
+    double elapsed_s = 0;
+};
+
+struct BBResult {
+    std::vector<int> sequence;
+    int makespan = 0;
+    long long nodes = 0;             // nodos generados (incluye los podados)
+    int initial_upper_bound = INT_MAX;   // incumbente con el que empezó la búsqueda
+    // Por cota (índice BoundKind): veces evaluada y nodos podados por ella
+    std::vector<long long> bound_evaluations;
+    std::vector<long long> bound_prunes;
+    std::vector<BBWorkerStats> workers;  // vacío en la búsqueda secuencial
+
+    // Primero el mejor
+    long long max_open_nodes = 0;
+    long long dfs_dives = 0;             // nodos resueltos en profundidad por falta de memoria
+    std::size_t peak_memory_bytes = 0;
+    std::size_t node_bytes = 0;          // tamaño de cada nodo en el pool
+
+    BBTelemetry telemetry;
+
+    // Puntos de control
+    long long checkpoints_written = 0;
+    long long resumed_subproblems = 0;   // frontera leída al reanudar
+
+    // Tabla de dominancia
+    long long dominance_lookups = 0;
+    long long dominance_hits = 0;
+    long long dominance_prunes = 0;
+    long long dominance_evictions = 0;
+    std::size_t dominance_bytes = 0;
+
+    // Modos anytime: una entrada por ancho de haz o número de discrepancias
+    std::vector<BBAnytimeStep> anytime;
+
+    // Ramificación bidireccional: nodos ramificados por cada lado
+    long long forward_branchings = 0;
+    long long backward_branchings = 0;
+};
+
+// Instancia de B&B desde la matriz plana máquinas x trabajos (FlatInstance::machine_major,
+// que en un .pfsb es el archivo mapeado), sin pasar por filas; el trabajo por máquina
+// sale de los agregados de esa misma matriz
+BBInstance make_bb_instance(const int* machine_major, int num_jobs, int num_machines,
+                            const InstanceAggregates& aggregates);
+// Matriz máquinas x trabajos en filas -> plana, fila a fila
+std::vector<int> machine_major_matrix(const std::vector<std::vector<int>>& processing_times);
+
+BBResult branch_and_bound(const std::vector<std::vector<int>>& processing_times,
+                          const BBParams& params = BBParams());
+BBResult branch_and_bound(const int* machine_major, int num_jobs, int num_machines,
+                          const BBParams& params = BBParams());
+
+// Makespan de una secuencia completa sobre la matriz plana máquinas x trabajos
+int sequence_makespan(const int* machine_major, int num_jobs, int num_machines,
+                      const std::vector<int>& sequence);
+
+// Lee las opciones del B&B de la línea de comandos (--bound=simple|lb1|johnson,
+// --pairs=adjacent|last|all, --no-neh, --no-ls, --ub=N, --threads=N, --grain=N,
+// --strategy=dfs|best|beam|lds, --memory-mb=N, --direction=forward|backward|alternate|fewest|bound,
+// --tt-mb=N, --tt-evict=deepest|lru|roundrobin, --checkpoint=ARCHIVO,
+// --checkpoint-every=SEG, --resume, --stats-every=SEG, --stats-json=ARCHIVO, --beam=W,
+// --idle-weight=X, --discrepancies=D). Los argumentos que no empiezan con '-' son rutas
+// de instancias y se guardan en instance_paths (si es null, son un error).
+// Devuelve false y muestra la ayuda si hay un error.
+bool parse_bb_args(int argc, char** argv, BBParams& params,
+                   std::vector<std::string>* instance_paths = nullptr);
+
+void print_bb_stats(const BBResult& result);
+
+std::vector<std::vector<int>> calculate_partial_completion(const std::vector<int>& partial_seq,
+                                                           const std::vector<std::vector<int>>& processing_times);
+
+std::vector<std::vector<int>> transpose_matrix(const std::vector<std::vector<int>>& matrix);
+
+#endif
@@ -0,0 +1,151 @@
+#include "BBSearch.h"
+
+#include <algorithm>
+#include <chrono>
+
+using namespace std;
+
+/*
+Modos anytime sobre el mismo árbol del B&B. Para n = 50 o 100 la búsqueda exacta no
+termina, pero la generación de hijos en lote, las cotas y la poda contra el incumbente
+sirven igual para construir soluciones:
+    - Haz: por nivel se conservan los W mejores prefijos según
+          cota + idle_weight * (tiempo ocioso que agrega el último trabajo) / M
+      El tiempo ocioso mide cuánto espera cada máquina al nuevo trabajo, y desempata
+      prefijos con la misma cota a favor de los que dejan menos huecos.
+    - Discrepancias limitadas: inmersión en profundidad que sigue el hijo de menor cota;
+      tomar el i-ésimo hijo (en orden de cota) consume i discrepancias del presupuesto.
+Ambos se repiten con anchos o presupuestos crecientes, y cada iteración poda con el
+incumbente de las anteriores. Son deterministas: los empates se rompen por índice.
+*/
+
+namespace {
+
+struct BeamCandidate {
+    double score;
+    int lb;
+    int parent;     // índice del prefijo padre en el nivel actual
+    int job;
+};
+
+bool better_candidate(const BeamCandidate& a, const BeamCandidate& b) {
+    if (a.score != b.score) return a.score < b.score;
+    if (a.lb != b.lb) return a.lb < b.lb;
+    if (a.parent != b.parent) return a.parent < b.parent;
+    return a.job < b.job;
+}
+
+// Tiempo ocioso total que provoca fijar 'job' tras la columna C: en cada máquina, lo
+// que pasa entre que queda libre y que el trabajo llega de la máquina anterior
+int idle_time(const BBInstance& inst, const int* C, const int* C_child, int job) {
+    int idle = 0;
+    for (int m = 0; m < inst.num_machines; m++) {
+        idle += C_child[m] - inst.time(m, job) - C[m];
+    }
+    return idle;
+}
+
+void record_leaf(SearchState& s, int makespan) {
+    if (makespan < s.best_makespan) {
+        s.best_makespan = makespan;
+        s.best_sequence = s.sequence;
+    }
+}
+
+void run_beam(SearchState& s, int width) {
+    const BBInstance& inst = s.inst;
+    const int N = inst.num_jobs;
+    const int M = inst.num_machines;
+    const double weight = s.params.idle_weight / max(1, M);
+
+    vector<int> level;              // prefijos del nivel actual, 'depth' trabajos cada uno
+    vector<int> next;
+    vector<int> prefix;
+    vector<BeamCandidate> candidates;
+    int beam_size = 1;
+
+    for (int depth = 0; depth < N; depth++) {
+        candidates.clear();
+        for (int b = 0; b < beam_size; b++) {
+            prefix.assign(level.begin() + b * depth, level.begin() + (b + 1) * depth);
+            s.load_prefix(prefix);
+            int count = generate_children(s, depth);
+            const ChildBound* kids = &s.children[depth * N];
+            const int* C = &s.completion[depth * M];
+            const int* C_child = &s.completion[(depth + 1) * M];
+
+            for (int i = 0; i < count; i++) {
+                if (kids[i].lb >= s.best_makespan) break;
+                load_child(s, depth, kids[i].job);
+                if (depth + 1 == N) {
+                    // Hoja: la cota es el makespan exacto
+                    record_leaf(s, kids[i].lb);
+                } else {
+                    double score = kids[i].lb + weight * idle_time(inst, C, C_child, kids[i].job);
+                    candidates.push_back({score, kids[i].lb, b, kids[i].job});
+                }
+                s.scheduled.reset(kids[i].job);
+            }
+        }
+        if (candidates.empty()) break;
+
+        beam_size = min<int>(width, candidates.size());
+        partial_sort(candidates.begin(), candidates.begin() + beam_size, candidates.end(),
+                     better_candidate);
+        next.resize(beam_size * (depth + 1));
+        for (int b = 0; b < beam_size; b++) {
+            const BeamCandidate& c = candidates[b];
+            copy(level.begin() + c.parent * depth, level.begin() + (c.parent + 1) * depth,
+                 next.begin() + b * (depth + 1));
+            next[b * (depth + 1) + depth] = c.job;
+        }
+        level.swap(next);
+    }
+}
+
+void discrepancy_dive(SearchState& s, int depth, int budget) {
+    const int N = s.inst.num_jobs;
+    if (depth == N) {
+        record_leaf(s, s.completion[N * s.inst.num_machines + s.inst.num_machines - 1]);
+        return;
+    }
+
+    int count = generate_children(s, depth);
+    const ChildBound* kids = &s.children[depth * N];
+    for (int i = 0; i < count && i <= budget; i++) {
+        if (kids[i].lb >= s.best_makespan) break;
+        load_child(s, depth, kids[i].job);
+        discrepancy_dive(s, depth + 1, budget - i);
+        s.scheduled.reset(kids[i].job);
+    }
+}
+
+}  // namespace
+
+void run_anytime(const BBParams& params, SearchState& root, BBResult& result) {
+    auto start = chrono::steady_clock::now();
+    auto record = [&](int level) {
+        BBAnytimeStep step;
+        step.level = level;
+        step.makespan = root.best_sequence.empty() ? 0 : root.best_makespan;
+        step.nodes = root.nodes;
+        step.elapsed_s = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        result.anytime.push_back(step);
+        root.flush_live();
+    };
+
+    if (params.strategy == BBStrategy::Beam) {
+        const int max_width = max(1, params.beam_width);
+        for (int width = 1;; width = min(2 * width, max_width)) {
+            run_beam(root, width);
+            record(width);
+            if (width == max_width) break;
+        }
+    } else {
+        for (int d = 0; d <= max(0, params.discrepancies); d++) {
+            root.load_prefix(vector<int>());
+            discrepancy_dive(root, 0, d);
+            record(d);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include "BBSearch.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <queue>
+
+using namespace std;
+
+/*
+Búsqueda primero el mejor: siempre se expande el nodo abierto de menor cota inferior,
+con lo que no se expande ningún nodo cuya cota supere el óptimo. A cambio hay que
+guardar la frontera completa, así que los nodos viven en un pool de bloques (slab) con
+un formato fijo y compacto:
+
+    [ cabecera: máscara de fijados, cota, profundidad | C[0..M) | secuencia[0..N) ]
+
+El trabajo restante por máquina no se guarda: se recalcula al expandir a partir de la
+secuencia. Los huecos liberados se reutilizan con una lista libre intrusiva.
+*/
+
+struct NodeHeader {
+    JobMask scheduled;
+    int32_t lb;
+    int32_t depth;
+};
+
+class NodePool {
+public:
+    NodePool(int num_machines, int num_jobs)
+        : stride_(layout_stride(num_machines, num_jobs)),
+          completion_offset_(sizeof(NodeHeader)),
+          sequence_offset_(sizeof(NodeHeader) + num_machines * sizeof(int32_t)) {}
+
+    uint32_t allocate() {
+        if (free_head_ != NONE) {
+            uint32_t id = free_head_;
+            memcpy(&free_head_, slot(id), sizeof(uint32_t));
+            live_++;
+            return id;
+        }
+        if (next_ == blocks_.size() * NODES_PER_BLOCK) {
+            blocks_.emplace_back(new char[stride_ * NODES_PER_BLOCK]);
+        }
+        live_++;
+        return next_++;
+    }
+
+    void release(uint32_t id) {
+        memcpy(slot(id), &free_head_, sizeof(uint32_t));
+        free_head_ = id;
+        live_--;
+    }
+
+    NodeHeader& header(uint32_t id) { return *reinterpret_cast<NodeHeader*>(slot(id)); }
+    int32_t* completion(uint32_t id) { return reinterpret_cast<int32_t*>(slot(id) + completion_offset_); }
+    uint8_t* sequence(uint32_t id) { return reinterpret_cast<uint8_t*>(slot(id) + sequence_offset_); }
+
+    size_t node_bytes() const { return stride_; }
+    size_t reserved_bytes() const { return blocks_.size() * NODES_PER_BLOCK * stride_; }
+    long long live() const { return live_; }
+
+private:
+    static const uint32_t NODES_PER_BLOCK = 4096;
+    static const uint32_t NONE = UINT32_MAX;
+
+    static size_t layout_stride(int num_machines, int num_jobs) {
+        size_t bytes = sizeof(NodeHeader) + num_machines * sizeof(int32_t) + num_jobs;
+        size_t align = alignof(NodeHeader);
+        return (bytes + align - 1) / align * align;
+    }
+
+    char* slot(uint32_t id) {
+        return blocks_[id / NODES_PER_BLOCK].get() + (size_t)(id % NODES_PER_BLOCK) * stride_;
+    }
+
+    size_t stride_;
+    size_t completion_offset_;
+    size_t sequence_offset_;
+    vector<unique_ptr<char[]>> blocks_;
+    uint32_t next_ = 0;
+    uint32_t free_head_ = NONE;
+    long long live_ = 0;
+};
+
+// Entrada de la cola de prioridad: menor cota primero y, a igual cota, el más profundo
+struct OpenEntry {
+    int lb;
+    int depth;
+    uint32_t node;
+
+    bool operator<(const OpenEntry& other) const {
+        if (lb != other.lb) return lb > other.lb;
+        return depth < other.depth;
+    }
+};
+
+// Carga el nodo del pool en la fila 'depth' del estado
+static void load_node(SearchState& s, NodePool& pool, uint32_t id) {
+    const BBInstance& inst = s.inst;
+    const int M = inst.num_machines;
+    const NodeHeader& h = pool.header(id);
+    const int depth = h.depth;
+    const uint8_t* seq = pool.sequence(id);
+
+    copy(pool.completion(id), pool.completion(id) + M, &s.completion[depth * M]);
+    int* R = &s.remaining[depth * M];
+    copy(inst.machine_work.begin(), inst.machine_work.end(), R);
+    for (int i = 0; i < depth; i++) {
+        s.sequence[i] = seq[i];
+        for (int m = 0; m < M; m++) R[m] -= inst.time(m, seq[i]);
+    }
+    s.scheduled = h.scheduled;
+}
+
+void run_best_first(const BBInstance& inst, const BBParams& params, SearchState& s, BBResult& result) {
+    const int M = inst.num_machines;
+    const int N = inst.num_jobs;
+    const size_t memory_limit = params.memory_limit_mb * 1024 * 1024;
+
+    NodePool pool(M, N);
+    priority_queue<OpenEntry> open;
+    size_t open_capacity = 0;   // entradas reservadas por la cola (crece al doble)
+
+    uint32_t root = pool.allocate();
+    pool.header(root).scheduled.reset();
+    pool.header(root).lb = 0;
+    pool.header(root).depth = 0;
+    fill(pool.completion(root), pool.completion(root) + M, 0);
+    open.push({0, 0, root});
+
+    while (!open.empty()) {
+        OpenEntry top = open.top();
+        open.pop();
+
+        // Todos los abiertos tienen cota >= top.lb: si no mejora, se termina
+        if (top.lb >= s.best_makespan) break;
+        if (s.live) s.live->raise_lower_bound(top.lb);
+
+        load_node(s, pool, top.node);
+        pool.release(top.node);
+        const int depth = top.depth;
+
+        // Con la memoria agotada se resuelve el nodo con una inmersión en profundidad
+        open_capacity = max(open_capacity, open.size());
+        size_t used = pool.reserved_bytes() + open_capacity * sizeof(OpenEntry);
+        result.peak_memory_bytes = max(result.peak_memory_bytes, used);
+        if (used >= memory_limit) {
+            result.dfs_dives++;
+            explore(s, depth);
+            continue;
+        }
+
+        int count = generate_children(s, depth);
+        const ChildBound* kids = &s.children[depth * N];
+        for (int i = 0; i < count; i++) {
+            // Una hoja anterior pudo mejorar el incumbente
+            if (kids[i].lb >= s.best_makespan) break;
+            const int job = kids[i].job;
+            const int child_lb = kids[i].lb;
+            load_child(s, depth, job);
+
+            if (depth + 1 == N) {
+                // Hoja: la cota simple es el makespan exacto y ya es menor al incumbente
+                s.best_makespan = s.completion[N * M + M - 1];
+                s.best_sequence = s.sequence;
+            } else {
+                uint32_t child = pool.allocate();
+                NodeHeader& h = pool.header(child);
+                h.scheduled = s.scheduled;
+                h.lb = child_lb;
+                h.depth = depth + 1;
+                copy(&s.completion[(depth + 1) * M], &s.completion[(depth + 2) * M], pool.completion(child));
+                uint8_t* seq = pool.sequence(child);
+                for (int d = 0; d < depth; d++) seq[d] = s.sequence[d];
+                seq[depth] = job;
+                open.push({child_lb, depth + 1, child});
+            }
+            s.scheduled.reset(job);
+        }
+        result.max_open_nodes = max(result.max_open_nodes, (long long)open.size());
+    }
+    result.node_bytes = pool.node_bytes();
+}
@@ -0,0 +1,210 @@
+#include "BBSearch.h"
+
+#include <algorithm>
+
+using namespace std;
+
+/*
+Ramificación bidireccional. Un nodo fija trabajos al principio (prefijo) y al final
+(sufijo) de la secuencia:
+    - C[m]: columna de finalización del prefijo, como en la búsqueda hacia adelante
+    - B[m]: la misma columna del sufijo sobre la instancia invertida (máquinas en orden
+      inverso y la secuencia leída al revés). Q[m] = B[M-1-m] es lo que tarda el sufijo
+      desde que empieza en la máquina m hasta el final.
+    - R[m]: trabajo de los no fijados en cada máquina
+Con U el conjunto de no fijados, max_m C[m] + R[m] + Q[m] es una cota inferior, y cuando
+U queda vacío es exactamente el makespan de prefijo + sufijo.
+
+En cada nodo se elige fijar adelante o atrás según BBParams::direction: alternando, por
+el lado con menos hijos que sobreviven a la poda, o por el lado con mejores cotas.
+*/
+
+struct BidirState {
+    const BBInstance& inst;
+    const BBInstance& rev;
+    const BBParams& params;
+    const BoundTables& tables;
+    SearchState& root;          // incumbente, secuencia parcial y contadores
+
+    vector<int> front;          // (N+1) x M, columnas del prefijo por profundidad
+    vector<int> back;           // (N+1) x M, columnas del sufijo (instancia invertida)
+    vector<int> remaining;      // (N+1) x M
+    vector<UnscheduledMinima> minima;
+    vector<int> child_bounds;   // (N+1) x 2N: cotas de los hijos hacia adelante y hacia atrás
+    vector<int> heads, tails;   // auxiliares de tamaño M
+    int front_count = 0;
+    int back_count = 0;
+
+    BidirState(const BBInstance& i, const BBInstance& r, const BBParams& p,
+               const BoundTables& t, SearchState& s)
+        : inst(i), rev(r), params(p), tables(t), root(s),
+          front((i.num_jobs + 1) * i.num_machines, 0),
+          back((i.num_jobs + 1) * i.num_machines, 0),
+          remaining((i.num_jobs + 1) * i.num_machines, 0),
+          minima(i.num_jobs + 1),
+          child_bounds((i.num_jobs + 1) * 2 * i.num_jobs, 0),
+          heads(i.num_machines), tails(i.num_machines) {}
+};
+
+// Columna tras agregar 'job' a una secuencia cuya columna es 'col'
+static inline void append_job(const BBInstance& inst, const int* col, int job, int* out) {
+    int c = 0;
+    for (int m = 0; m < inst.num_machines; m++) {
+        c = max(c, col[m]) + inst.time(m, job);
+        out[m] = c;
+    }
+}
+
+// Deriva en la fila depth + 1 el hijo que fija 'job' adelante o atrás
+static void derive_child(BidirState& s, int depth, int job, bool backward) {
+    const int M = s.inst.num_machines;
+    const int* C = &s.front[depth * M];
+    const int* B = &s.back[depth * M];
+    const int* R = &s.remaining[depth * M];
+    int* C2 = &s.front[(depth + 1) * M];
+    int* B2 = &s.back[(depth + 1) * M];
+    int* R2 = &s.remaining[(depth + 1) * M];
+
+    if (backward) {
+        append_job(s.rev, B, job, B2);
+        copy(C, C + M, C2);
+    } else {
+        append_job(s.inst, C, job, C2);
+        copy(B, B + M, B2);
+    }
+    for (int m = 0; m < M; m++) R2[m] = R[m] - s.inst.time(m, job);
+}
+
+// Cota inferior del hijo. Con cotas fuertes se refinan cabezas y colas con los
+// tiempos mínimos de los no fijados (excluyendo 'job'), como en LB1.
+static int child_bound(BidirState& s, int depth, int job, bool backward, bool strong) {
+    const int M = s.inst.num_machines;
+    SearchState& r = s.root;
+    derive_child(s, depth, job, backward);
+    const int* C2 = &s.front[(depth + 1) * M];
+    const int* B2 = &s.back[(depth + 1) * M];
+    const int* R2 = &s.remaining[(depth + 1) * M];
+
+    int lb = 0;
+    for (int m = 0; m < M; m++) lb = max(lb, C2[m] + R2[m] + B2[M - 1 - m]);
+    r.nodes++;
+    r.bound_evaluations[(int)BoundKind::Simple]++;
+    if (lb >= r.best_makespan) {
+        r.bound_prunes[(int)BoundKind::Simple]++;
+        return lb;
+    }
+    if (!strong) return lb;
+
+    // Cabezas: la máquina m no empieza el siguiente no fijado antes de h[m-1] más el
+    // mínimo en m-1. Colas: tras el último no fijado en m queda al menos el mínimo en
+    // m+1 seguido del sufijo, o la cola mínima de los no fijados.
+    const UnscheduledMinima& mins = s.minima[depth];
+    auto child_min = [&](int m) { return mins.p_arg[m] == job ? mins.p2[m] : mins.p1[m]; };
+    int* h = s.heads.data();
+    int* t = s.tails.data();
+    h[0] = C2[0];
+    for (int m = 1; m < M; m++) h[m] = max(C2[m], h[m - 1] + child_min(m - 1));
+    t[M - 1] = B2[0];
+    for (int m = M - 2; m >= 0; m--) t[m] = max(B2[M - 1 - m], t[m + 1] + child_min(m + 1));
+
+    r.bound_evaluations[(int)BoundKind::LB1]++;
+    int strong_lb = lb;
+    for (int m = 0; m < M; m++) {
+        int tail = max(t[m], mins.t_arg[m] == job ? mins.t2[m] : mins.t1[m]);
+        strong_lb = max(strong_lb, h[m] + R2[m] + tail);
+    }
+    if (strong_lb >= r.best_makespan) r.bound_prunes[(int)BoundKind::LB1]++;
+    return strong_lb;
+}
+
+static void explore_bidirectional(BidirState& s, int depth) {
+    const int M = s.inst.num_machines;
+    const int N = s.inst.num_jobs;
+    SearchState& r = s.root;
+
+    // Prefijo y sufijo cubren todos los trabajos: makespan exacto
+    if (depth == N) {
+        const int* C = &s.front[depth * M];
+        const int* B = &s.back[depth * M];
+        int makespan = 0;
+        for (int m = 0; m < M; m++) makespan = max(makespan, C[m] + B[M - 1 - m]);
+        if (makespan < r.best_makespan) {
+            r.best_makespan = makespan;
+            r.best_sequence = r.sequence;
+        }
+        return;
+    }
+
+    r.on_expand(depth);
+    bool strong = s.params.bound != BoundKind::Simple && depth + 1 < N;
+    if (strong) compute_minima(s.inst, s.tables, r.scheduled, s.minima[depth]);
+
+    int* fwd = &s.child_bounds[depth * 2 * N];
+    int* bwd = fwd + N;
+
+    // Elegir el lado a ramificar
+    bool backward;
+    if (s.params.direction == BranchDirection::Alternate) {
+        backward = depth % 2 == 1;
+        int* lbs = backward ? bwd : fwd;
+        for (int job = 0; job < N; job++) {
+            if (!r.scheduled[job]) lbs[job] = child_bound(s, depth, job, backward, strong);
+        }
+    } else {
+        int alive_f = 0, alive_b = 0;
+        long long sum_f = 0, sum_b = 0;
+        for (int job = 0; job < N; job++) {
+            if (r.scheduled[job]) continue;
+            fwd[job] = child_bound(s, depth, job, false, strong);
+            bwd[job] = child_bound(s, depth, job, true, strong);
+            alive_f += fwd[job] < r.best_makespan;
+            alive_b += bwd[job] < r.best_makespan;
+            sum_f += min(fwd[job], r.best_makespan);
+            sum_b += min(bwd[job], r.best_makespan);
+        }
+        if (s.params.direction == BranchDirection::FewestChildren && alive_f != alive_b) {
+            backward = alive_b < alive_f;
+        } else {
+            backward = sum_b > sum_f;
+        }
+    }
+    if (backward) r.backward_branchings++;
+    else r.forward_branchings++;
+
+    const int* lbs = backward ? bwd : fwd;
+    for (int job = 0; job < N; job++) {
+        if (r.scheduled[job] || lbs[job] >= r.best_makespan) continue;
+
+        derive_child(s, depth, job, backward);
+        r.scheduled.set(job);
+        if (backward) {
+            r.sequence[N - 1 - s.back_count] = job;
+            s.back_count++;
+        } else {
+            r.sequence[s.front_count] = job;
+            s.front_count++;
+        }
+
+        explore_bidirectional(s, depth + 1);
+
+        if (backward) s.back_count--;
+        else s.front_count--;
+        r.scheduled.reset(job);
+    }
+}
+
+void run_bidirectional(const BBInstance& inst, const BBParams& params, const BoundTables& tables,
+                       SearchState& root) {
+    // Instancia invertida: la máquina m pasa a ser la M-1-m
+    BBInstance rev = inst;
+    for (int m = 0; m < inst.num_machines; m++) {
+        for (int j = 0; j < inst.num_jobs; j++) {
+            rev.p[m * inst.num_jobs + j] = inst.time(inst.num_machines - 1 - m, j);
+        }
+        rev.machine_work[m] = inst.machine_work[inst.num_machines - 1 - m];
+    }
+
+    BidirState state(inst, rev, params, tables, root);
+    copy(inst.machine_work.begin(), inst.machine_work.end(), state.remaining.begin());
+    explore_bidirectional(state, 0);
+}
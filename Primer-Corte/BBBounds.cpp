@@ -0,0 +1,141 @@
+#include "BBBounds.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
+
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+const char* bound_name(BoundKind kind) {
+    switch (kind) {
+        case BoundKind::Simple: return "simple";
+        case BoundKind::LB1: return "lb1";
+        case BoundKind::Johnson: return "johnson";
+    }
+    return "?";
+}
+
+BoundTables make_bound_tables(const BBInstance& inst, const InstanceAggregates& aggregates,
+                              BoundKind kind, JohnsonPairs pairs) {
+    const int M = inst.num_machines;
+    const int N = inst.num_jobs;
+    BoundTables tables;
+
+    tables.tail.assign(M * N, 0);
+    for (int m = M - 2; m >= 0; m--) {
+        for (int j = 0; j < N; j++) {
+            tables.tail[m * N + j] = tables.tail[(m + 1) * N + j] + inst.time(m + 1, j);
+        }
+    }
+
+    if (kind != BoundKind::Johnson || M < 2) return tables;
+
+    for (int k = 0; k < M - 1; k++) {
+        for (int l = k + 1; l < M; l++) {
+            bool take = pairs == JohnsonPairs::All ||
+                        (pairs == JohnsonPairs::Adjacent && l == k + 1) ||
+                        (pairs == JohnsonPairs::LastMachine && l == M - 1);
+            if (take) tables.pairs.push_back({k, l});
+        }
+    }
+
+    // Orden de Johnson-Mitten de cada par con los retardos de las máquinas intermedias
+    for (const auto& kl : tables.pairs) {
+        vector<int> lag(N, 0);
+        for (int j = 0; j < N; j++) lag[j] = aggregates.lag(kl.first, kl.second, j);
+        tables.pair_order.push_back(aggregates.johnson_order(kl.first, kl.second));
+        tables.pair_lag.push_back(lag);
+    }
+    return tables;
+}
+
+void compute_minima(const BBInstance& inst,
+                    const BoundTables& tables,
+                    const JobMask& scheduled,
+                    UnscheduledMinima& out) {
+    const int M = inst.num_machines;
+    const int N = inst.num_jobs;
+    const int INF = numeric_limits<int>::max() / 4;
+
+    out.p1.assign(M, INF); out.p2.assign(M, INF); out.p_arg.assign(M, -1);
+    out.t1.assign(M, INF); out.t2.assign(M, INF); out.t_arg.assign(M, -1);
+
+    for (int j = 0; j < N; j++) {
+        if (scheduled[j]) continue;
+        for (int m = 0; m < M; m++) {
+            int p = inst.time(m, j);
+            if (p < out.p1[m]) { out.p2[m] = out.p1[m]; out.p1[m] = p; out.p_arg[m] = j; }
+            else if (p < out.p2[m]) { out.p2[m] = p; }
+
+            int t = tables.tail[m * N + j];
+            if (t < out.t1[m]) { out.t2[m] = out.t1[m]; out.t1[m] = t; out.t_arg[m] = j; }
+            else if (t < out.t2[m]) { out.t2[m] = t; }
+        }
+    }
+}
+
+// Mínimo del hijo que fija 'job': el del padre salvo que el mínimo fuera 'job'
+static inline int child_min(int first, int second, int arg, int job) {
+    return arg == job ? second : first;
+}
+
+// Cabezas del hijo: la máquina m no puede empezar el siguiente trabajo antes de
+// h[m-1] + (mínimo tiempo restante en m-1), ni antes de quedar libre (C[m]).
+static inline void child_heads(const UnscheduledMinima& mins, const int* C, int M, int job, int* h) {
+    h[0] = C[0];
+    for (int m = 1; m < M; m++) {
+        h[m] = max(C[m], h[m - 1] + child_min(mins.p1[m - 1], mins.p2[m - 1], mins.p_arg[m - 1], job));
+    }
+}
+
+int lb1_child(const BBInstance& inst,
+              const UnscheduledMinima& mins,
+              const int* C,
+              const int* R,
+              int job) {
+    const int M = inst.num_machines;
+    thread_local vector<int> h;
+    h.resize(M);
+    child_heads(mins, C, M, job, h.data());
+
+    int bound = 0;
+    for (int m = 0; m < M; m++) {
+        int tail = child_min(mins.t1[m], mins.t2[m], mins.t_arg[m], job);
+        bound = max(bound, h[m] + R[m] + tail);
+    }
+    return bound;
+}
+
+int johnson_child(const BBInstance& inst,
+                  const BoundTables& tables,
+                  const UnscheduledMinima& mins,
+                  const int* C,
+                  const JobMask& scheduled_child,
+                  int job,
+                  int cutoff) {
+    const int M = inst.num_machines;
+    thread_local vector<int> h;
+    h.resize(M);
+    child_heads(mins, C, M, job, h.data());
+
+    int bound = 0;
+    for (size_t q = 0; q < tables.pairs.size(); q++) {
+        int k = tables.pairs[q].first;
+        int l = tables.pairs[q].second;
+        const vector<int>& lag = tables.pair_lag[q];
+
+        // Problema de dos máquinas relajado: las máquinas entre k y l solo retrasan
+        int t1 = h[k];
+        int t2 = h[l];
+        for (int j : tables.pair_order[q]) {
+            if (scheduled_child[j]) continue;
+            t1 += inst.time(k, j);
+            t2 = max(t2, t1 + lag[j]) + inst.time(l, j);
+        }
+        int pair_bound = t2 + child_min(mins.t1[l], mins.t2[l], mins.t_arg[l], job);
+
+        bound = max(bound, pair_bound);
+        if (bound >= cutoff) break;
+    }
+    return bound;
+}
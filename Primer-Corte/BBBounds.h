@@ -0,0 +1,62 @@
+#ifndef BB_BOUNDS_H
+#define BB_BOUNDS_H
+
+#include "BB.h"
+
+#include <utility>
+#include <vector>
+
+// Cotas inferiores disponibles. Cada una incluye a las anteriores: LB1 solo se
+// evalúa si la cota simple no poda, y Johnson solo si LB1 tampoco poda.
+enum class BoundKind { Simple = 0, LB1 = 1, Johnson = 2 };
+const int BB_NUM_BOUNDS = 3;
+
+// Pares de máquinas (k, l) sobre los que se evalúa la cota de Johnson
+enum class JohnsonPairs { Adjacent, LastMachine, All };
+
+const char* bound_name(BoundKind kind);
+
+// Tablas que dependen solo de la instancia, calculadas una vez antes de la búsqueda
+struct BoundTables {
+    std::vector<int> tail;                       // tail[m * N + j] = suma de p[l][j] con l > m
+    std::vector<std::pair<int, int>> pairs;      // pares (k, l), k < l
+    std::vector<std::vector<int>> pair_order;    // orden de Johnson-Mitten de cada par
+    std::vector<std::vector<int>> pair_lag;      // retardo de cada trabajo entre k y l
+};
+
+// Los órdenes de Johnson de cada par salen de los agregados de la instancia
+BoundTables make_bound_tables(const BBInstance& inst, const InstanceAggregates& aggregates,
+                              BoundKind kind, JohnsonPairs pairs);
+
+// Mínimos por máquina sobre los trabajos no fijados de un nodo. Se guarda también el
+// segundo mínimo para obtener en O(1) el mínimo de cada hijo (que excluye a su trabajo).
+struct UnscheduledMinima {
+    std::vector<int> p1, p2, p_arg;              // tiempo de proceso mínimo en cada máquina
+    std::vector<int> t1, t2, t_arg;              // cola mínima después de cada máquina
+};
+
+void compute_minima(const BBInstance& inst,
+                    const BoundTables& tables,
+                    const JobMask& scheduled,
+                    UnscheduledMinima& out);
+
+// LB1 (cota por máquina con cabezas y colas) del hijo que fija 'job'.
+// C y R son la columna de finalización y el trabajo restante del hijo, que debe
+// tener al menos un trabajo sin fijar (en una hoja la cota simple ya es exacta).
+int lb1_child(const BBInstance& inst,
+              const UnscheduledMinima& mins,
+              const int* C,
+              const int* R,
+              int job);
+
+// Cota de dos máquinas de Johnson (Lageweg et al., 1978) del hijo que fija 'job':
+// máximo sobre los pares seleccionados. Se detiene en cuanto alcanza 'cutoff'.
+int johnson_child(const BBInstance& inst,
+                  const BoundTables& tables,
+                  const UnscheduledMinima& mins,
+                  const int* C,
+                  const JobMask& scheduled_child,
+                  int job,
+                  int cutoff);
+
+#endif
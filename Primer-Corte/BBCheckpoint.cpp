@@ -0,0 +1,175 @@
+#include "BBCheckpoint.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+using namespace std;
+
+static const char CHECKPOINT_MAGIC[8] = {'P', 'F', 'B', 'B', 'C', 'K', 'P', 'T'};
+static const uint32_t CHECKPOINT_VERSION = 1;
+
+// FNV-1a sobre dimensiones y tiempos de procesamiento
+uint64_t instance_checksum(const BBInstance& inst) {
+    uint64_t h = 1469598103934665603ULL;
+    auto mix = [&h](uint64_t value) {
+        for (int i = 0; i < 8; i++) {
+            h ^= (value >> (8 * i)) & 0xff;
+            h *= 1099511628211ULL;
+        }
+    };
+    mix(inst.num_jobs);
+    mix(inst.num_machines);
+    for (int p : inst.p) mix((uint32_t)p);
+    return h;
+}
+
+// Enteros en little endian byte a byte, sin depender del orden de la máquina
+template <typename T>
+static void put(string& out, T value) {
+    uint64_t bits = static_cast<typename make_unsigned<T>::type>(value);
+    for (size_t i = 0; i < sizeof(T); i++) out.push_back(static_cast<char>((bits >> (8 * i)) & 0xff));
+}
+
+template <typename T>
+static bool get(ifstream& in, T& value) {
+    unsigned char bytes[sizeof(T)];
+    if (!in.read(reinterpret_cast<char*>(bytes), sizeof(T))) return false;
+    uint64_t bits = 0;
+    for (size_t i = 0; i < sizeof(T); i++) bits |= (uint64_t)bytes[i] << (8 * i);
+    value = static_cast<T>(static_cast<typename make_unsigned<T>::type>(bits));
+    return true;
+}
+
+static void put_jobs(string& out, const vector<int>& jobs) {
+    for (int job : jobs) put<uint8_t>(out, job);
+}
+
+static bool get_jobs(ifstream& in, vector<int>& jobs, size_t count, uint32_t num_jobs) {
+    jobs.resize(count);
+    for (size_t i = 0; i < count; i++) {
+        uint8_t job;
+        if (!get(in, job) || job >= num_jobs) return false;
+        jobs[i] = job;
+    }
+    return true;
+}
+
+// Escribe todo 'data' en 'path' y lo baja a disco antes de cerrar
+static bool write_file_synced(const string& path, const string& data) {
+    int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return false;
+    size_t written = 0;
+    while (written < data.size()) {
+        ssize_t r = write(fd, data.data() + written, data.size() - written);
+        if (r < 0 && errno == EINTR) continue;
+        if (r <= 0) {
+            close(fd);
+            return false;
+        }
+        written += r;
+    }
+    bool ok = fsync(fd) == 0;
+    return close(fd) == 0 && ok;
+}
+
+// Baja a disco la entrada del directorio de 'path' (el rename)
+static bool sync_parent_directory(const string& path) {
+    size_t slash = path.find_last_of('/');
+    string dir = slash == string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+    int fd = open(dir.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) return false;
+    bool ok = fsync(fd) == 0;
+    close(fd);
+    return ok;
+}
+
+bool write_checkpoint(const string& path, const BBCheckpoint& c) {
+    string tmp = path + ".tmp";
+    {
+        string out;
+        out.append(CHECKPOINT_MAGIC, sizeof(CHECKPOINT_MAGIC));
+        put<uint32_t>(out, CHECKPOINT_VERSION);
+        put<uint32_t>(out, c.num_jobs);
+        put<uint32_t>(out, c.num_machines);
+        put<uint64_t>(out, c.checksum);
+
+        put<int32_t>(out, c.best_makespan);
+        put<uint32_t>(out, c.best_sequence.size());
+        put_jobs(out, c.best_sequence);
+
+        put<int64_t>(out, c.nodes);
+        for (int b = 0; b < BB_NUM_BOUNDS; b++) put<int64_t>(out, b < (int)c.bound_evaluations.size() ? c.bound_evaluations[b] : 0);
+        for (int b = 0; b < BB_NUM_BOUNDS; b++) put<int64_t>(out, b < (int)c.bound_prunes.size() ? c.bound_prunes[b] : 0);
+        put<int64_t>(out, c.elapsed_ms);
+
+        put<uint64_t>(out, c.frontier.size());
+        for (const vector<int>& prefix : c.frontier) {
+            put<uint8_t>(out, prefix.size());
+            put_jobs(out, prefix);
+        }
+        if (!write_file_synced(tmp, out)) {
+            cerr << "Error al escribir el punto de control " << tmp << ": " << strerror(errno) << endl;
+            return false;
+        }
+    }
+    // El contenido ya está en disco antes del rename, y el rename se baja después:
+    // tras una caída queda el punto de control anterior o el nuevo completo
+    if (rename(tmp.c_str(), path.c_str()) != 0) {
+        cerr << "No se pudo renombrar " << tmp << " a " << path << endl;
+        return false;
+    }
+    if (!sync_parent_directory(path)) {
+        cerr << "No se pudo sincronizar el directorio de " << path << ": " << strerror(errno) << endl;
+        return false;
+    }
+    return true;
+}
+
+bool read_checkpoint(const string& path, BBCheckpoint& c) {
+    ifstream in(path, ios::binary);
+    if (!in) {
+        cerr << "No se pudo abrir el punto de control " << path << endl;
+        return false;
+    }
+
+    char magic[sizeof(CHECKPOINT_MAGIC)];
+    uint32_t version;
+    if (!in.read(magic, sizeof(magic)) || memcmp(magic, CHECKPOINT_MAGIC, sizeof(magic)) != 0 ||
+        !get(in, version) || version != CHECKPOINT_VERSION) {
+        cerr << path << " no es un punto de control válido" << endl;
+        return false;
+    }
+
+    uint32_t sequence_size;
+    uint64_t frontier_size;
+    bool ok = get(in, c.num_jobs) && get(in, c.num_machines) && get(in, c.checksum) &&
+              c.num_jobs <= (uint32_t)BB_MAX_JOBS &&
+              get(in, c.best_makespan) && get(in, sequence_size) && sequence_size <= c.num_jobs &&
+              get_jobs(in, c.best_sequence, sequence_size, c.num_jobs) &&
+              get(in, c.nodes);
+    c.bound_evaluations.assign(BB_NUM_BOUNDS, 0);
+    c.bound_prunes.assign(BB_NUM_BOUNDS, 0);
+    for (int b = 0; ok && b < BB_NUM_BOUNDS; b++) ok = get(in, c.bound_evaluations[b]);
+    for (int b = 0; ok && b < BB_NUM_BOUNDS; b++) ok = get(in, c.bound_prunes[b]);
+    ok = ok && get(in, c.elapsed_ms) && get(in, frontier_size);
+
+    c.frontier.clear();
+    for (uint64_t i = 0; ok && i < frontier_size; i++) {
+        uint8_t length;
+        vector<int> prefix;
+        ok = get(in, length) && length <= c.num_jobs && get_jobs(in, prefix, length, c.num_jobs);
+        c.frontier.push_back(move(prefix));
+    }
+    if (!ok) {
+        cerr << "Punto de control " << path << " truncado o corrupto" << endl;
+        return false;
+    }
+    return true;
+}
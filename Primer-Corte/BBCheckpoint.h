@@ -0,0 +1,48 @@
+#ifndef BB_CHECKPOINT_H
+#define BB_CHECKPOINT_H
+
+#include "BB.h"
+#include "BBBounds.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/*
+Punto de control del B&B: frontera (subproblemas abiertos como prefijos de la
+secuencia), incumbente y estadísticas. La frontera no depende del número de hilos:
+al reanudar, los prefijos se reparten entre los hilos que haya.
+
+Formato binario (little endian, enteros de ancho fijo):
+    "PFBBCKPT" | versión u32 | N u32 | M u32 | checksum de la instancia u64
+    mejor makespan i32 | largo de la mejor secuencia u32 | trabajos u8...
+    nodos i64 | evaluaciones por cota i64 x BB_NUM_BOUNDS | podas por cota i64 x BB_NUM_BOUNDS
+    tiempo acumulado en ms i64
+    número de subproblemas u64 | por cada uno: largo u8 | trabajos u8...
+*/
+struct BBCheckpoint {
+    std::uint32_t num_jobs = 0;
+    std::uint32_t num_machines = 0;
+    std::uint64_t checksum = 0;
+
+    std::int32_t best_makespan = 0;
+    std::vector<int> best_sequence;
+
+    std::int64_t nodes = 0;
+    std::vector<std::int64_t> bound_evaluations;
+    std::vector<std::int64_t> bound_prunes;
+    std::int64_t elapsed_ms = 0;
+
+    std::vector<std::vector<int>> frontier;
+};
+
+// Huella de la instancia, para no reanudar con datos distintos
+std::uint64_t instance_checksum(const BBInstance& inst);
+
+// Escribe en 'path.tmp', hace fsync, renombra y hace fsync del directorio, así el
+// archivo nunca queda a medio escribir, ni siquiera si se cae la máquina
+bool write_checkpoint(const std::string& path, const BBCheckpoint& checkpoint);
+
+bool read_checkpoint(const std::string& path, BBCheckpoint& checkpoint);
+
+#endif
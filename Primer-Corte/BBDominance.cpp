@@ -0,0 +1,90 @@
+#include "BBDominance.h"
+
+#include <algorithm>
+#include <functional>
+
+using namespace std;
+
+DominanceTable::DominanceTable(int num_machines, size_t memory_bytes, TTEviction eviction)
+    : num_machines_(num_machines), eviction_(eviction) {
+    size_t slot_bytes = sizeof(JobMask) + num_machines * sizeof(int) + sizeof(uint32_t) + sizeof(int16_t);
+    num_buckets_ = max<size_t>(1, memory_bytes / (slot_bytes * TT_BUCKET_SLOTS));
+    size_t slots = num_buckets_ * TT_BUCKET_SLOTS;
+    keys_.resize(slots);
+    columns_.resize(slots * num_machines);
+    stamps_.assign(slots, 0);
+    depths_.assign(slots, -1);
+}
+
+size_t DominanceTable::memory_bytes() const {
+    return keys_.size() * sizeof(JobMask) + columns_.size() * sizeof(int) +
+           stamps_.size() * sizeof(uint32_t) + depths_.size() * sizeof(int16_t);
+}
+
+// Entrada a desalojar de un cubo lleno
+size_t DominanceTable::choose_victim(size_t base) {
+    size_t victim = base;
+    for (size_t slot = base + 1; slot < base + TT_BUCKET_SLOTS; slot++) {
+        switch (eviction_) {
+        case TTEviction::LeastRecentlyUsed:
+            if (stamps_[slot] < stamps_[victim]) victim = slot;
+            break;
+        case TTEviction::Deepest:
+            // Las entradas profundas cubren subárboles pequeños: se desalojan primero
+            if (depths_[slot] > depths_[victim] ||
+                (depths_[slot] == depths_[victim] && stamps_[slot] < stamps_[victim])) victim = slot;
+            break;
+        case TTEviction::RoundRobin:
+            break;
+        }
+    }
+    if (eviction_ == TTEviction::RoundRobin) victim = base + clock_ % TT_BUCKET_SLOTS;
+    return victim;
+}
+
+bool DominanceTable::dominated_or_insert(const JobMask& mask, const int* col, int depth) {
+    const int M = num_machines_;
+    size_t base = hash<JobMask>()(mask) % num_buckets_ * TT_BUCKET_SLOTS;
+    lookups++;
+    clock_++;
+
+    size_t target = SIZE_MAX;
+    bool hit = false;
+    for (size_t slot = base; slot < base + TT_BUCKET_SLOTS; slot++) {
+        if (depths_[slot] < 0) {
+            if (target == SIZE_MAX) target = slot;
+            continue;
+        }
+        if (keys_[slot] != mask) continue;
+        hit = true;
+
+        const int* stored = column(slot);
+        bool stored_le = true, col_le = true;
+        for (int m = 0; m < M; m++) {
+            stored_le &= stored[m] <= col[m];
+            col_le &= col[m] <= stored[m];
+        }
+        if (stored_le) {
+            hits++;
+            prunes++;
+            stamps_[slot] = clock_;
+            return true;
+        }
+        if (col_le) {
+            // El nuevo domina a la entrada: se reutiliza su lugar
+            depths_[slot] = -1;
+            target = slot;
+        }
+    }
+    if (hit) hits++;
+
+    if (target == SIZE_MAX) {
+        target = choose_victim(base);
+        evictions++;
+    }
+    keys_[target] = mask;
+    copy(col, col + M, column(target));
+    stamps_[target] = clock_;
+    depths_[target] = depth;
+    return false;
+}
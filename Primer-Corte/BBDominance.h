@@ -0,0 +1,53 @@
+#ifndef BB_DOMINANCE_H
+#define BB_DOMINANCE_H
+
+#include "BB.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/*
+Tabla de dominancia (tabla de transposición) del B&B. Dos órdenes distintos del mismo
+conjunto de trabajos fijados dejan los mismos trabajos por fijar; si la columna de
+finalización de uno es, máquina a máquina, <= la del otro, el segundo no puede llevar
+a un makespan mejor y se poda.
+
+La tabla tiene tamaño fijo (según el tope de memoria) y es asociativa por conjuntos:
+la máscara se reduce a un cubo de TT_BUCKET_SLOTS entradas, cada una con una máscara
+y una columna no dominada. Si el cubo está lleno se desaloja según la política elegida.
+*/
+
+const int TT_BUCKET_SLOTS = 4;
+
+class DominanceTable {
+public:
+    DominanceTable(int num_machines, std::size_t memory_bytes, TTEviction eviction);
+
+    // Devuelve true si (mask, column) está dominado por una entrada guardada. Si no,
+    // lo guarda, reemplazando las entradas de la misma máscara que él domine.
+    bool dominated_or_insert(const JobMask& mask, const int* column, int depth);
+
+    std::size_t memory_bytes() const;
+
+    long long lookups = 0;
+    long long hits = 0;        // consultas que encontraron la misma máscara
+    long long prunes = 0;      // nodos podados por dominancia
+    long long evictions = 0;   // entradas desalojadas para hacer lugar
+
+private:
+    int num_machines_;
+    std::size_t num_buckets_;
+    TTEviction eviction_;
+    std::uint32_t clock_ = 0;
+
+    std::vector<JobMask> keys_;
+    std::vector<int> columns_;            // slots x M
+    std::vector<std::uint32_t> stamps_;   // último uso, para LRU
+    std::vector<std::int16_t> depths_;    // -1 = vacío
+
+    int* column(std::size_t slot) { return &columns_[slot * num_machines_]; }
+    std::size_t choose_victim(std::size_t base);
+};
+
+#endif
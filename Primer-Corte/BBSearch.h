@@ -0,0 +1,148 @@
+#ifndef BB_SEARCH_H
+#define BB_SEARCH_H
+
+// Estado interno de la búsqueda, compartido por las estrategias del B&B
+// (profundidad, paralela y primero el mejor). No forma parte de la API pública.
+
+#include "BB.h"
+#include "BBBounds.h"
+#include "BBDominance.h"
+#include "BBTelemetry.h"
+
+#include <atomic>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Incumbente compartido por los hilos del B&B paralelo. El makespan es atómico para
+// que cada hilo pode con el mejor global de inmediato; la secuencia solo cambia al
+// mejorar, lo que es raro, así que basta con un mutex.
+struct SharedIncumbent {
+    std::atomic<int> makespan;
+    std::mutex lock;
+    std::vector<int> sequence;
+
+    explicit SharedIncumbent(int initial) : makespan(initial) {}
+
+    void offer(int value, const std::vector<int>& seq) {
+        std::lock_guard<std::mutex> guard(lock);
+        if (value < makespan.load(std::memory_order_relaxed)) {
+            sequence = seq;
+            makespan.store(value, std::memory_order_relaxed);
+        }
+    }
+};
+
+// Hijo generado de un nodo: su cota inferior y el trabajo que fija
+struct ChildBound {
+    int lb;
+    int job;
+};
+
+/*
+Estado de la búsqueda en profundidad. En lugar de reconstruir la matriz completa de
+finalización M x k y copiar vectores en cada hijo, cada nivel d guarda solo:
+    - la última columna de finalización (C[d][m], tiempo en que la máquina m queda libre)
+    - el trabajo restante por máquina (R[d][m], suma de tiempos de los no fijados)
+Un hijo se deriva de su padre en O(M):
+    C'[m] = max(C'[m-1], C[m]) + p[m][job],   R'[m] = R[m] - p[m][job]
+y los trabajos fijados se llevan en una máscara de bits.
+
+Los hijos de un nodo se generan en lote (ver generate_children): las columnas de todos
+ellos se calculan máquina por máquina sobre arreglos contiguos indexados por candidato,
+lo que el compilador vectoriza, y se guardan ordenados por cota en children[d].
+*/
+struct SearchState {
+    const BBInstance& inst;
+    const BBParams& params;
+    const BoundTables& tables;
+    SharedIncumbent* shared = nullptr;  // solo en la búsqueda paralela
+    std::unique_ptr<DominanceTable> dominance;   // null si está desactivada
+    BBLiveStats* live = nullptr;                 // estadísticas en vivo compartidas
+    std::vector<UnscheduledMinima> minima;   // uno por profundidad
+    std::vector<int> completion;   // (N+1) x M, fila d = columna tras fijar d trabajos
+    std::vector<int> remaining;    // (N+1) x M, fila d = trabajo restante por máquina
+    std::vector<int> sequence;     // secuencia parcial (las primeras d posiciones son válidas)
+    JobMask scheduled;
+
+    std::vector<ChildBound> children;   // (N+1) x N, hijos de cada nivel ordenados por cota
+    std::vector<int> batch_jobs;        // candidatos del lote en curso
+    std::vector<int> batch_times;       // M x K, tiempos de proceso de los candidatos
+    std::vector<int> batch_columns;     // M x K, columnas de finalización de los hijos
+    std::vector<int> batch_bounds;      // K, cota simple de cada hijo
+
+    int best_makespan;
+    std::vector<int> best_sequence;
+    long long nodes = 0;
+    long long bound_evaluations[BB_NUM_BOUNDS] = {0, 0, 0};
+    long long bound_prunes[BB_NUM_BOUNDS] = {0, 0, 0};
+    long long forward_branchings = 0;
+    long long backward_branchings = 0;
+    long long expanded = 0;
+    int max_depth = 0;
+
+    // Lo ya volcado en 'live'
+    long long flushed_nodes = 0;
+    long long flushed_expanded = 0;
+    long long flushed_prunes[BB_NUM_BOUNDS] = {0, 0, 0};
+    long long flushed_dominance = 0;
+
+    SearchState(const BBInstance& instance, const BBParams& p, const BoundTables& t)
+        : inst(instance),
+          params(p),
+          tables(t),
+          minima(instance.num_jobs + 1),
+          completion((instance.num_jobs + 1) * instance.num_machines, 0),
+          remaining((instance.num_jobs + 1) * instance.num_machines, 0),
+          sequence(instance.num_jobs, -1),
+          children((instance.num_jobs + 1) * instance.num_jobs),
+          batch_jobs(instance.num_jobs),
+          batch_times(instance.num_machines * instance.num_jobs),
+          batch_columns(instance.num_machines * instance.num_jobs),
+          batch_bounds(instance.num_jobs),
+          best_makespan(std::numeric_limits<int>::max()) {}
+
+    // Coloca el estado en el nodo dado por 'prefix' (fila d = prefix.size())
+    void load_prefix(const std::vector<int>& prefix);
+
+    void enable_dominance(std::size_t memory_bytes) {
+        dominance.reset(new DominanceTable(inst.num_machines, memory_bytes, params.dominance_eviction));
+    }
+
+    // Cuenta la expansión de un nodo y vuelca los contadores cada 1024 expansiones
+    void on_expand(int depth) {
+        expanded++;
+        if (depth > max_depth) max_depth = depth;
+        if (live && (expanded & 1023) == 0) flush_live();
+    }
+
+    void flush_live();
+    void mark_flushed();
+
+    // Suma los contadores de la tabla de dominancia al resultado
+    void report_dominance(BBResult& result) const;
+};
+
+// Genera y acota todos los hijos del nodo cargado en la fila 'depth'. Los que
+// sobreviven quedan en children[depth * N ...] en orden ascendente de cota (empates
+// por trabajo) y se devuelve cuántos son. No modifica la fila depth + 1.
+int generate_children(SearchState& s, int depth);
+
+// Carga en la fila depth + 1 el hijo que fija 'job' y lo marca como fijado
+void load_child(SearchState& s, int depth, int job);
+
+// Exploración recursiva en profundidad desde el nodo cargado en la fila 'depth'
+void explore(SearchState& s, int depth);
+
+// Ramificación bidireccional en profundidad (ver BBBidirectional.cpp)
+void run_bidirectional(const BBInstance& inst, const BBParams& params, const BoundTables& tables,
+                       SearchState& root);
+
+// Modos anytime de haz y discrepancias limitadas (ver BBAnytime.cpp)
+void run_anytime(const BBParams& params, SearchState& root, BBResult& result);
+
+// Búsqueda primero el mejor (ver BBBestFirst.cpp)
+void run_best_first(const BBInstance& inst, const BBParams& params, SearchState& root, BBResult& result);
+
+#endif
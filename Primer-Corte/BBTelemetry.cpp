@@ -0,0 +1,172 @@
+#include "BBTelemetry.h"
+#include "BBSearch.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+
+using namespace std;
+
+BBLiveStats::BBLiveStats(int initial_incumbent, int root_lb)
+    : incumbent(initial_incumbent), lower_bound(root_lb) {
+    for (int b = 0; b < BB_NUM_BOUNDS; b++) pruned[b] = 0;
+}
+
+void BBLiveStats::raise_lower_bound(int value) {
+    int current = lower_bound.load(memory_order_relaxed);
+    while (value > current && !lower_bound.compare_exchange_weak(current, value, memory_order_relaxed)) {}
+}
+
+void BBLiveStats::lower_incumbent(int value) {
+    int current = incumbent.load(memory_order_relaxed);
+    while (value < current && !incumbent.compare_exchange_weak(current, value, memory_order_relaxed)) {}
+}
+
+void BBLiveStats::raise_max_depth(int value) {
+    int current = max_depth.load(memory_order_relaxed);
+    while (value > current && !max_depth.compare_exchange_weak(current, value, memory_order_relaxed)) {}
+}
+
+TelemetryReporter::TelemetryReporter(const BBInstance& inst, const BBParams& params,
+                                     const BoundTables& tables, BBLiveStats& live)
+    : inst_(inst), params_(params), tables_(tables), live_(live),
+      start_(chrono::steady_clock::now()) {
+    if (params.stats_interval_s > 0) thread_ = thread(&TelemetryReporter::run, this);
+}
+
+TelemetryReporter::~TelemetryReporter() {
+    finish();
+}
+
+BBTelemetry TelemetryReporter::finish() {
+    {
+        lock_guard<mutex> guard(lock_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    if (thread_.joinable()) thread_.join();
+    return snapshot();
+}
+
+/*
+Estimación de Knuth del número de nodos generados: una sonda baja desde la raíz
+eligiendo al azar uno de los hijos que sobreviven a la poda. Si en el nivel i se
+generan g_i hijos y sobreviven k_i, el árbol tiene en esperanza
+    sum_i g_i * prod_{l<i} k_l
+nodos generados. Se promedia sobre varias sondas con el incumbente actual.
+*/
+double TelemetryReporter::knuth_estimate(int probes, unsigned seed) {
+    const int N = inst_.num_jobs;
+    SearchState s(inst_, params_, tables_);
+    mt19937 rng(seed);
+    double total = 0;
+
+    for (int probe = 0; probe < probes; probe++) {
+        s.best_makespan = live_.incumbent.load(memory_order_relaxed);
+        s.load_prefix(vector<int>());
+        double weight = 1;
+        double estimate = 0;
+        for (int depth = 0; depth < N; depth++) {
+            int count = generate_children(s, depth);
+            estimate += weight * (N - depth);
+            if (count == 0) break;
+            weight *= count;
+
+            int pick = uniform_int_distribution<int>(0, count - 1)(rng);
+            load_child(s, depth, s.children[depth * N + pick].job);
+        }
+        total += estimate;
+    }
+    return total / probes;
+}
+
+void TelemetryReporter::run() {
+    auto interval = chrono::milliseconds((long long)(params_.stats_interval_s * 1000));
+    unsigned seed = 1;
+    unique_lock<mutex> guard(lock_);
+    while (!wake_.wait_for(guard, interval, [this] { return stop_; })) {
+        guard.unlock();
+        tree_estimate_ = knuth_estimate(params_.stats_probes, seed++);
+        probes_ += params_.stats_probes;
+        print_telemetry(snapshot());
+        guard.lock();
+    }
+}
+
+BBTelemetry TelemetryReporter::snapshot() const {
+    BBTelemetry t;
+    t.elapsed_s = chrono::duration<double>(chrono::steady_clock::now() - start_).count();
+    t.nodes_generated = live_.generated.load();
+    t.nodes_expanded = live_.expanded.load();
+    t.pruned.resize(BB_NUM_BOUNDS);
+    for (int b = 0; b < BB_NUM_BOUNDS; b++) t.pruned[b] = live_.pruned[b].load();
+    t.dominance_prunes = live_.dominance_prunes.load();
+    t.max_depth = live_.max_depth.load();
+    t.nodes_per_s = t.elapsed_s > 0 ? t.nodes_generated / t.elapsed_s : 0;
+    t.incumbent = live_.incumbent.load();
+    t.lower_bound = min(live_.lower_bound.load(), t.incumbent);
+    t.gap = t.incumbent > 0 && t.incumbent != INT_MAX ? double(t.incumbent - t.lower_bound) / t.incumbent : 1.0;
+    t.tree_size_estimate = tree_estimate_.load();
+    t.knuth_probes = probes_.load();
+    // Al ritmo actual: lo que falta del árbol estimado en proporción a lo ya generado
+    if (t.tree_size_estimate > 0 && t.nodes_generated > 0) {
+        t.eta_s = max(0.0, t.elapsed_s * (t.tree_size_estimate / t.nodes_generated - 1));
+    }
+    return t;
+}
+
+void print_telemetry(const BBTelemetry& t) {
+    // Se arma aparte para no dejar el formato (fixed, precisión) pegado a cout
+    ostringstream line;
+    line << fixed << setprecision(1)
+         << "[" << t.elapsed_s << " s] generados " << t.nodes_generated
+         << ", expandidos " << t.nodes_expanded
+         << ", prof. máx " << t.max_depth
+         << ", " << (long long)t.nodes_per_s << " nodos/s"
+         << ", incumbente " << t.incumbent
+         << ", cota " << t.lower_bound
+         << ", gap " << setprecision(2) << 100 * t.gap << "%";
+    if (t.tree_size_estimate > 0) {
+        line << ", árbol estimado " << setprecision(3) << scientific << t.tree_size_estimate
+             << fixed << setprecision(1) << " ("
+             << min(100.0, 100 * t.nodes_generated / t.tree_size_estimate) << "%)";
+    }
+    if (t.eta_s >= 0) line << ", ETA " << t.eta_s << " s";
+    cout << line.str() << endl;
+}
+
+bool write_telemetry_json(const string& path, const BBTelemetry& t) {
+    ofstream out(path);
+    if (!out) {
+        cerr << "No se pudo escribir " << path << endl;
+        return false;
+    }
+    out << "{\n"
+        << "  \"elapsed_s\": " << t.elapsed_s << ",\n"
+        << "  \"nodes_generated\": " << t.nodes_generated << ",\n"
+        << "  \"nodes_expanded\": " << t.nodes_expanded << ",\n"
+        << "  \"pruned\": {";
+    for (int b = 0; b < (int)t.pruned.size(); b++) {
+        out << (b ? ", " : "") << "\"" << bound_name((BoundKind)b) << "\": " << t.pruned[b];
+    }
+    out << ", \"dominance\": " << t.dominance_prunes << "},\n"
+        << "  \"max_depth\": " << t.max_depth << ",\n"
+        << "  \"nodes_per_s\": " << t.nodes_per_s << ",\n"
+        << "  \"incumbent\": " << t.incumbent << ",\n"
+        << "  \"lower_bound\": " << t.lower_bound << ",\n"
+        << "  \"gap\": " << t.gap << ",\n"
+        << "  \"tree_size_estimate\": " << t.tree_size_estimate << ",\n"
+        << "  \"knuth_probes\": " << t.knuth_probes << ",\n"
+        << "  \"eta_s\": ";
+    if (t.eta_s >= 0) {
+        out << t.eta_s;
+    } else {
+        out << "null";
+    }
+    out << "\n"
+        << "}\n";
+    return (bool)out;
+}
@@ -0,0 +1,72 @@
+#ifndef BB_TELEMETRY_H
+#define BB_TELEMETRY_H
+
+#include "BB.h"
+#include "BBBounds.h"
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/*
+Estadísticas en vivo del B&B. Cada hilo de búsqueda acumula sus contadores localmente
+y los vuelca aquí cada cierto número de expansiones (SearchState::flush_live), así el
+costo en el camino caliente es una comparación. Un hilo aparte las imprime cada
+BBParams::stats_interval_s segundos junto con una estimación del tamaño del árbol.
+*/
+struct BBLiveStats {
+    std::atomic<long long> generated{0};
+    std::atomic<long long> expanded{0};
+    std::atomic<long long> pruned[BB_NUM_BOUNDS];
+    std::atomic<long long> dominance_prunes{0};
+    std::atomic<int> max_depth{0};
+    std::atomic<int> incumbent;
+    std::atomic<int> lower_bound;
+
+    BBLiveStats(int initial_incumbent, int root_lower_bound);
+
+    void raise_lower_bound(int value);
+    void lower_incumbent(int value);
+    void raise_max_depth(int value);
+};
+
+class TelemetryReporter {
+public:
+    TelemetryReporter(const BBInstance& inst, const BBParams& params, const BoundTables& tables,
+                      BBLiveStats& live);
+    ~TelemetryReporter();
+
+    // Fotografía de las estadísticas con la última estimación del árbol
+    BBTelemetry snapshot() const;
+
+    // Detiene el hilo de reporte (si lo hay) y devuelve la fotografía final
+    BBTelemetry finish();
+
+private:
+    const BBInstance& inst_;
+    const BBParams& params_;
+    const BoundTables& tables_;
+    BBLiveStats& live_;
+    std::chrono::steady_clock::time_point start_;
+
+    std::atomic<double> tree_estimate_{0};
+    std::atomic<long long> probes_{0};
+
+    std::mutex lock_;
+    std::condition_variable wake_;
+    bool stop_ = false;
+    std::thread thread_;
+
+    void run();
+    double knuth_estimate(int probes, unsigned seed);
+};
+
+void print_telemetry(const BBTelemetry& t);
+
+bool write_telemetry_json(const std::string& path, const BBTelemetry& t);
+
+#endif
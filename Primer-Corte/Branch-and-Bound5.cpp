@@ -1,206 +1,15 @@
 #include <iostream>
 #include <vector>
-#include <algorithm>
-#include <limits>
 #include <chrono>
+#include "BB.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+#include "BBBounds.h"
 
 using namespace std;
 
-// Función para calcular la matriz de tiempos de finalización para una secuencia parcial
-vector<vector<int>> calculate_partial_completion(const vector<int>& partial_seq, 
-                                                 const vector<vector<int>>& processing_times) {
-    /*
-    Calcula la matriz de tiempos de finalización para una secuencia parcial de trabajos
-    en un Permutation Flow Shop.
-    
-    Args:
-        partial_seq: Índices de trabajos ya secuenciados
-        processing_times: Matriz MxN de tiempos de procesamiento (M máquinas x N trabajos)
-        
-    Returns:
-        Matriz de tiempos de finalización de tamaño M x len(partial_seq)
-    */
-    
-    if (partial_seq.empty()) {
-        return vector<vector<int>>(processing_times.size(), vector<int>());
-    }
-    
-    int num_machines = processing_times.size();
-    int num_jobs = partial_seq.size();
-    vector<vector<int>> C(num_machines, vector<int>(num_jobs, 0));
-    
-    for (int j = 0; j < num_jobs; j++) {
-        int job = partial_seq[j];
-        for (int m = 0; m < num_machines; m++) {
-            if (j == 0 && m == 0) {
-                C[m][j] = processing_times[m][job];
-            } else if (j == 0) {
-                C[m][j] = C[m-1][j] + processing_times[m][job];
-            } else if (m == 0) {
-                C[m][j] = C[m][j-1] + processing_times[m][job];
-            } else {
-                C[m][j] = max(C[m-1][j], C[m][j-1]) + processing_times[m][job];
-            }
-        }
-    }
-    
-    return C;
-}
-
-// Función para calcular la cota inferior en Branch and Bound
-int lower_bound_bb(const vector<vector<int>>& C_partial,
-                   const vector<int>& remaining_jobs,
-                   const vector<vector<int>>& processing_times) {
-    /*
-    Calcula una cota inferior realista para una secuencia parcial en Branch and Bound.
-    
-    La cota inferior se calcula como el máximo entre los tiempos de finalización actuales
-    de la secuencia parcial y una estimación optimista de los trabajos restantes.
-    */
-    
-    if (remaining_jobs.empty()) {
-        if (C_partial.empty() || C_partial[0].empty()) {
-            return 0;
-        }
-        return C_partial.back().back(); // Último elemento de la última máquina
-    }
-    
-    int num_machines = processing_times.size();
-    
-    // Últimos tiempos de finalización de la secuencia parcial
-    vector<int> last_times(num_machines, 0);
-    if (!C_partial.empty() && !C_partial[0].empty()) {
-        for (int m = 0; m < num_machines; m++) {
-            last_times[m] = C_partial[m].back();
-        }
-    }
-    
-    // Estimación optimista: suma de tiempos de procesamiento de trabajos restantes por máquina
-    vector<int> est_remaining(num_machines, 0);
-    for (int m = 0; m < num_machines; m++) {
-        for (int job : remaining_jobs) {
-            est_remaining[m] += processing_times[m][job];
-        }
-    }
-    
-    // Calcular el máximo considerando las restricciones de las máquinas
-    int bound = 0;
-    for (int m = 0; m < num_machines; m++) {
-        int machine_bound = last_times[m] + est_remaining[m];
-        if (machine_bound > bound) {
-            bound = machine_bound;
-        }
-    }
-    
-    return bound;
-}
-
-// Variables globales para la recursión
-int best_flowtime;
-vector<int> best_sequence;
-
-// Función recursiva de exploración en Branch and Bound
-void explore(const vector<int>& partial_seq,
-             const vector<int>& remaining_jobs,
-             const vector<vector<int>>& C_partial,
-             const vector<vector<int>>& processing_times) {
-    
-    // Calcular cota inferior
-    int lb = lower_bound_bb(C_partial, remaining_jobs, processing_times);
-    
-    // Podar si la cota es mayor o igual al mejor flujo encontrado
-    if (lb >= best_flowtime) {
-        return;
-    }
-    
-    // Si no quedan trabajos, hemos encontrado una secuencia completa
-    if (remaining_jobs.empty()) {
-        if (!C_partial.empty() && !C_partial[0].empty()) {
-            int current_flowtime = C_partial.back().back();
-            if (current_flowtime < best_flowtime) {
-                best_flowtime = current_flowtime;
-                best_sequence = partial_seq;
-            }
-        }
-        return;
-    }
-    
-    // Explorar todos los trabajos restantes
-    for (size_t i = 0; i < remaining_jobs.size(); i++) {
-        // Crear nueva secuencia parcial
-        vector<int> new_seq = partial_seq;
-        new_seq.push_back(remaining_jobs[i]);
-        
-        // Crear nueva lista de trabajos restantes
-        vector<int> new_remaining;
-        for (size_t j = 0; j < remaining_jobs.size(); j++) {
-            if (j != i) {
-                new_remaining.push_back(remaining_jobs[j]);
-            }
-        }
-        
-        // Calcular nueva matriz de finalización
-        vector<vector<int>> C_new = calculate_partial_completion(new_seq, processing_times);
-        
-        // Llamada recursiva
-        explore(new_seq, new_remaining, C_new, processing_times);
-    }
-}
-
-// Función principal de Branch and Bound
-pair<vector<int>, int> branch_and_bound(const vector<vector<int>>& processing_times) {
-    /*
-    Resuelve el problema PFSP usando Branch and Bound exacto.
-    
-    Args:
-        processing_times: Matriz MxN de tiempos de procesamiento
-        
-    Returns:
-        pair<mejor_secuencia, mejor_flowtime>
-    */
-    
-    int num_jobs = processing_times[0].size();
-    
-    // Inicializar variables globales
-    best_flowtime = numeric_limits<int>::max();
-    best_sequence.clear();
-    
-    // Crear lista de todos los trabajos
-    vector<int> all_jobs;
-    for (int i = 0; i < num_jobs; i++) {
-        all_jobs.push_back(i);
-    }
-    
-    // Iniciar exploración
-    vector<int> empty_seq;
-    vector<vector<int>> empty_C(processing_times.size(), vector<int>());
-    explore(empty_seq, all_jobs, empty_C, processing_times);
-    
-    return make_pair(best_sequence, best_flowtime);
-}
-
-// Función para transponer una matriz
-vector<vector<int>> transpose_matrix(const vector<vector<int>>& matrix) {
-    if (matrix.empty()) return {};
-    
-    int num_machines = matrix[0].size();
-    int num_jobs = matrix.size();
-    
-    vector<vector<int>> transposed(num_machines, vector<int>(num_jobs, 0));
-    
-    for (int i = 0; i < num_jobs; i++) {
-        for (int j = 0; j < num_machines; j++) {
-            transposed[j][i] = matrix[i][j];
-        }
-    }
-    
-    return transposed;
-}
-
-// Función para medir tiempo de ejecución
-void measure_execution_time() {
-    // Datos de ejemplo (matriz 20x5)
-    vector<vector<int>> processing_times = {
+// Datos de ejemplo (matriz 20x5)
+static vector<vector<int>> example_instance() {
+    return {
     {23, 24,  9,  9, 17,  8, 30,  5, 13, 11, 12,  5, 18,  8, 14, 16,  4, 13,  3, 29},
     {29, 19, 25, 24, 11, 15, 26,  3, 12, 28, 10, 20, 14, 16, 19,  5,  3, 24, 14, 19},
     { 9,  1, 21, 12, 18,  4, 19, 26,  2, 23,  8,  1,  9, 22, 20,  9,  3, 24, 14, 10},
@@ -301,21 +110,21 @@ void measure_execution_time() {
     { 1, 23, 14,  5,  9, 11,  1, 26, 19,  9, 23, 20, 10,  7, 10,  6,  3,  5,  9, 18},
     {19,  7, 12, 14,  3, 12, 19, 26,  9, 22, 12, 26,  8, 25,  2, 18,  6, 19, 11, 14},
     { 4, 24, 30,  3,  5, 29, 21,  4,  5,  1, 10, 29,  3, 19, 29,  9, 18,  7,  7, 19}
-};
-    
-    // Transponer la matriz (convertir a formato máquinas x trabajos)
-    vector<vector<int>> transposed = transpose_matrix(processing_times);
+    };
+}
+
+// Función para medir tiempo de ejecución
+void measure_execution_time(const FlatInstance& instance, const BBParams& params) {
     
-    cout << "Matriz original: " << processing_times.size() 
-         << " trabajos x " << processing_times[0].size() << " máquinas" << endl;
-    cout << "Matriz transpuesta: " << transposed.size() 
-         << " máquinas x " << transposed[0].size() << " trabajos" << endl;
+    // El B&B lee la matriz plana máquinas x trabajos de la instancia (en un .pfsb, el
+    // archivo mapeado) sin armar filas
+    cout << "Matriz: " << instance.n << " trabajos x " << instance.m << " máquinas" << endl;
     
     // Medir tiempo de ejecución
     auto start = chrono::high_resolution_clock::now();
     
     // Ejecutar Branch and Bound
-    auto result = branch_and_bound(transposed);
+    auto result = branch_and_bound(instance.machine_major(), instance.n, instance.m, params);
     
     auto end = chrono::high_resolution_clock::now();
     auto duration = chrono::duration_cast<chrono::milliseconds>(end - start);
@@ -323,34 +132,56 @@ void measure_execution_time() {
     // Mostrar resultados
     cout << "\n=== RESULTADOS ===" << endl;
     cout << "Mejor secuencia encontrada: ";
-    for (int job : result.first) {
+    for (int job : result.sequence) {
         cout << job << " ";
     }
     cout << endl;
     
-    cout << "Mínimo flowtime (makespan): " << result.second << endl;
+    cout << "Mínimo flowtime (makespan): " << result.makespan << endl;
+    print_bb_stats(result);
     cout << "Tiempo de ejecución: " << duration.count() << " ms" << endl;
     
+    if (result.sequence.empty()) {
+        cout << "No existe una secuencia con makespan menor o igual a la cota superior dada" << endl;
+        return;
+    }
+
     // Verificar secuencia con cálculo directo
     cout << "\n=== VERIFICACIÓN ===" << endl;
-    vector<int> verification_seq = result.first;
-    vector<vector<int>> C_verif = calculate_partial_completion(verification_seq, transposed);
-    int calculated_flowtime = C_verif.back().back();
+    int calculated_flowtime = sequence_makespan(instance.machine_major(), instance.n, instance.m, result.sequence);
     cout << "Flowtime calculado para la secuencia: " << calculated_flowtime << endl;
     
-    if (calculated_flowtime == result.second) {
+    if (calculated_flowtime == result.makespan) {
         cout << "✓ Verificación exitosa" << endl;
     } else {
         cout << "✗ Error en la verificación" << endl;
     }
 }
 
-int main() {
+int main(int argc, char** argv) {
+    BBParams params;
+    vector<string> paths;
+    if (!parse_bb_args(argc, argv, params, &paths)) return 1;
+
     cout << "==========================================" << endl;
     cout << "ALGORITMO BRANCH AND BOUND PARA PFSP" << endl;
     cout << "==========================================" << endl;
     
-    measure_execution_time();
+    cout << "Cota inferior: " << bound_name(params.bound) << endl;
+    // Sin rutas de instancias se usa la matriz de ejemplo
+    if (paths.empty()) {
+        vector<vector<int>> example = example_instance();
+        measure_execution_time(flatten_instance("ejemplo", example.size(), example[0].size(), 0, example), params);
+    } else {
+        vector<FlatInstance> instances;
+        load_instances(paths, instances);
+        for (const auto& instance : instances) {
+            cout << "\nInstancia: " << instance.name << endl;
+            params.aggregates = &instance.aggregates();
+            measure_execution_time(instance, params);
+        }
+        if (instances.empty()) return 1;
+    }
     
     cout << "\n==========================================" << endl;
     cout << "Nota: Para instancias más grandes (n > 10)," << endl;
@@ -1,9 +1,15 @@
 #include "ILS.h"
 #include "LS.h"
 #include "NEH.h"
+#include "../Segundo-Corte/genetic-algorithm/Budget.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <ctime>
 #include <iostream>
+#include <memory>
+#include <thread>
 
 using namespace std;
 
@@ -19,32 +25,285 @@ vector<int> perturbacion_swap(vector<int> secuencia, int fuerza) {
     return secuencia;
 }
 
-vector<int> ILS(const vector<int>& solucion_inicial,
-                const vector<vector<int>>& tiempos,
-                int m,
-                int max_iters) {
+vector<int> perturbacion_swap(vector<int> secuencia, int fuerza, mt19937& rng) {
+    int n = secuencia.size();
+    uniform_int_distribution<int> pos(0, n - 1);
+
+    for (int k = 0; k < fuerza; ++k) {
+        int i = pos(rng);
+        int j = pos(rng);
+        swap(secuencia[i], secuencia[j]);
+    }
+    return secuencia;
+}
+
+// Mejor solucion compartida entre hilos. El makespan es un atomico que cualquier hilo
+// consulta sin bloquear; la secuencia vive en un arreglo de atomicos protegido por un
+// seqlock: 'version' es impar mientras un escritor la modifica y los lectores reintentan
+// si la version cambio durante su copia.
+class IncumbenteCompartido {
+public:
+    IncumbenteCompartido(int n, chrono::steady_clock::time_point inicio)
+        : n_(n), secuencia_(new atomic<int>[n]) {
+        traza_.restart(inicio);
+    }
+
+    int makespan() const { return mejor_makespan_.load(memory_order_acquire); }
+
+    // Publica (secuencia, ms) si mejora al incumbente. Devuelve true si lo reemplazo.
+    // 'evaluaciones' es el total de todos los hilos, para la traza.
+    bool publicar(const vector<int>& secuencia, int ms, long long evaluaciones) {
+        if (ms >= mejor_makespan_.load(memory_order_relaxed)) return false;
+
+        // Tomar el seqlock como escritor (version par -> impar)
+        unsigned v = version_.load(memory_order_relaxed);
+        while (true) {
+            if ((v & 1u) == 0 &&
+                version_.compare_exchange_weak(v, v + 1, memory_order_acquire, memory_order_relaxed)) {
+                break;
+            }
+            this_thread::yield();
+            v = version_.load(memory_order_relaxed);
+        }
+        // La version impar debe verse antes que cualquiera de los datos que siguen: sin
+        // esta barrera un lector podria copiar datos nuevos con la version par vieja
+        atomic_thread_fence(memory_order_release);
+
+        bool mejora = ms < mejor_makespan_.load(memory_order_relaxed);
+        if (mejora) {
+            for (int i = 0; i < n_; ++i) {
+                secuencia_[i].store(secuencia[i], memory_order_relaxed);
+            }
+            mejor_makespan_.store(ms, memory_order_relaxed);
+            traza_.record(evaluaciones, ms);
+        }
+
+        version_.store(v + 2, memory_order_release);
+        return mejora;
+    }
+
+    // Copia consistente de la secuencia incumbente y su makespan
+    int leer(vector<int>& secuencia) const {
+        secuencia.resize(n_);
+        while (true) {
+            unsigned v1 = version_.load(memory_order_acquire);
+            if (v1 & 1u) {
+                this_thread::yield();
+                continue;
+            }
+            for (int i = 0; i < n_; ++i) {
+                secuencia[i] = secuencia_[i].load(memory_order_relaxed);
+            }
+            int ms = mejor_makespan_.load(memory_order_relaxed);
+            atomic_thread_fence(memory_order_acquire);
+            if (version_.load(memory_order_relaxed) == v1) return ms;
+        }
+    }
+
+    // Solo debe llamarse cuando no quedan escritores
+    const ConvergenceTrace& traza() const { return traza_; }
+
+private:
+    int n_;
+    unique_ptr<atomic<int>[]> secuencia_;
+    atomic<int> mejor_makespan_{2000000000};
+    atomic<unsigned> version_{0};
+    ConvergenceTrace traza_;            // protegida por el seqlock de escritura
+};
+
+// Contexto comun de una ejecucion (secuencial o paralela)
+struct ContextoILS {
+    const vector<vector<int>>& tiempos;
+    int m;
+    const ILSParams& params;
+    SearchBudget presupuesto;          // max_iters se compara con las iteraciones de cada caminata
+    atomic<long long> evaluaciones_totales{0};
+    IncumbenteCompartido* incumbente = nullptr;  // nullptr en la version secuencial
+};
+
+// Una caminata ILS: busqueda local, perturbacion, aceptacion de la refinada y reinicio
+// tras estancamiento. Con incumbente compartido, publica sus mejoras y salta al
+// incumbente si lleva 'max_retraso' iteraciones por detras de el.
+static ILSResult caminata_ils(const vector<int>& solucion_inicial, ContextoILS& ctx, mt19937& rng) {
+    const ILSParams& params = ctx.params;
+    ILSResult res;
+
+    auto presupuesto_agotado = [&]() {
+        return ctx.presupuesto.exhausted(res.iteraciones, ctx.evaluaciones_totales.load(memory_order_relaxed));
+    };
 
-    vector<int> actual = local_search_insertion(solucion_inicial, tiempos, m);
-    vector<int> mejor = actual;
+    // Cada vecino de la busqueda local es una posicion de insercion de Taillard; van a
+    // la fase abierta (inicializacion, reinicio o busqueda local)
+    auto busqueda_local = [&](const vector<int>& s) {
+        long long evals = 0;
+        vector<int> r = local_search_insertion_taillard(s, ctx.tiempos, ctx.m, &evals);
+        res.evaluaciones += evals;
+        ctx.evaluaciones_totales.fetch_add(evals, memory_order_relaxed);
+        res.perfil.count_partial(evals);
+        res.perfil.count_neighbours(evals);
+        return r;
+    };
 
-    int mejor_coste = calcular_makespan(mejor, tiempos, m);
+    vector<int> actual;
+    int coste_actual;
+    {
+        ScopedPhase fase(res.perfil, Phase::Initialization);
+        actual = busqueda_local(solucion_inicial);
+        coste_actual = calcular_makespan(actual, ctx.tiempos, ctx.m);
+        res.evaluaciones_completas++;
+        res.perfil.count_full(1);
+    }
+
+    res.mejor = actual;
+    res.mejor_makespan = coste_actual;
+    res.traza.restart(ctx.presupuesto.start());
+    res.traza.record(res.evaluaciones, coste_actual);
+    if (ctx.incumbente) {
+        ctx.incumbente->publicar(actual, coste_actual, ctx.evaluaciones_totales.load(memory_order_relaxed));
+    }
+
+    // Si 'actual' mejora la mejor de la caminata: la guarda, la anota en la traza y la
+    // publica al incumbente compartido
+    auto registrar_mejora = [&]() {
+        if (coste_actual >= res.mejor_makespan) return false;
+        res.mejor = actual;
+        res.mejor_makespan = coste_actual;
+        res.traza.record(res.evaluaciones, coste_actual);
+        if (ctx.incumbente) {
+            ctx.incumbente->publicar(actual, coste_actual, ctx.evaluaciones_totales.load(memory_order_relaxed));
+        }
+        return true;
+    };
+
+    int sin_mejora = 0;
+    int retraso = 0;
 
-    for (int iter = 0; iter < max_iters; ++iter) {
+    while (!presupuesto_agotado()) {
+
+        // Saltar al incumbente global si esta caminata se quedo atras demasiado tiempo.
+        // Tras el salto el incumbente pasa a ser su referencia: solo vuelve a saltar si
+        // otro hilo lo mejora y esta caminata no lo alcanza.
+        if (ctx.incumbente && params.max_retraso > 0) {
+            if (ctx.incumbente->makespan() < res.mejor_makespan) {
+                if (++retraso >= params.max_retraso) {
+                    ScopedPhase fase(res.perfil, Phase::Restart);
+                    coste_actual = ctx.incumbente->leer(actual);
+                    res.mejor = actual;
+                    res.mejor_makespan = coste_actual;
+                    retraso = 0;
+                    sin_mejora = 0;
+                    res.reinicios++;
+                }
+            } else {
+                retraso = 0;
+            }
+        }
+
+        // Reinicio tras un estancamiento largo
+        if (params.max_sin_mejora > 0 && sin_mejora >= params.max_sin_mejora) {
+            ScopedPhase fase(res.perfil, Phase::Restart);
+            vector<int> aleatoria = res.mejor;
+            shuffle(aleatoria.begin(), aleatoria.end(), rng);
+            actual = busqueda_local(aleatoria);
+            coste_actual = calcular_makespan(actual, ctx.tiempos, ctx.m);
+            res.evaluaciones_completas++;
+            res.perfil.count_full(1);
+            registrar_mejora();
+            sin_mejora = 0;
+            res.reinicios++;
+        }
 
         // Perturbacion
-        vector<int> perturbada = perturbacion_swap(actual, 5);
+        vector<int> perturbada;
+        {
+            ScopedPhase fase(res.perfil, Phase::Mutation);
+            perturbada = perturbacion_swap(actual, params.fuerza, rng);
+        }
 
         // Busqueda local
-        vector<int> refinada = local_search_insertion(perturbada, tiempos, m);
-        int coste = calcular_makespan(refinada, tiempos, m);
+        vector<int> refinada;
+        {
+            ScopedPhase fase(res.perfil, Phase::LocalSearch);
+            refinada = busqueda_local(perturbada);
+        }
+        int coste;
+        {
+            ScopedPhase fase(res.perfil, Phase::Evaluation);
+            coste = calcular_makespan(refinada, ctx.tiempos, ctx.m);
+            res.evaluaciones_completas++;
+            res.perfil.count_full(1);
+        }
+        res.iteraciones++;
+
+        // Aceptacion: siempre se continua desde la solucion refinada
+        actual = refinada;
+        coste_actual = coste;
 
-        // Aceptacion
-        if (coste < mejor_coste) {
-            mejor = refinada;
-            mejor_coste = coste;
-            break;
+        if (registrar_mejora()) {
+            sin_mejora = 0;
+        } else {
+            sin_mejora++;
         }
-        actual = refinada;  
     }
-    return mejor;
+    return res;
+}
+
+vector<int> ILS(const vector<int>& solucion_inicial,
+                const vector<vector<int>>& tiempos,
+                int m,
+                int max_iters) {
+    ILSParams params;
+    params.max_iters = max_iters;
+    // Respeta srand() como la version original; 0 significaria semilla aleatoria
+    unsigned int semilla = rand();
+    params.semilla = semilla != 0 ? semilla : 1;
+    return ILS_presupuesto(solucion_inicial, tiempos, m, params).mejor;
+}
+
+ILSResult ILS_presupuesto(const vector<int>& solucion_inicial,
+                          const vector<vector<int>>& tiempos,
+                          int m,
+                          const ILSParams& params) {
+    ContextoILS ctx{tiempos, m, params,
+                    SearchBudget(params.max_iters, params.tiempo_limite_ms, params.max_evaluaciones)};
+    mt19937 rng(params.semilla == 0 ? random_device{}() : params.semilla);
+    return caminata_ils(solucion_inicial, ctx, rng);
+}
+
+ILSResult ILS_paralelo(const vector<int>& solucion_inicial,
+                       const vector<vector<int>>& tiempos,
+                       int m,
+                       const ILSParams& params) {
+    int hilos = params.hilos > 0 ? params.hilos : (int)thread::hardware_concurrency();
+    if (hilos < 1) hilos = 1;
+
+    ContextoILS ctx{tiempos, m, params,
+                    SearchBudget(params.max_iters, params.tiempo_limite_ms, params.max_evaluaciones)};
+    IncumbenteCompartido incumbente(solucion_inicial.size(), ctx.presupuesto.start());
+    ctx.incumbente = &incumbente;
+
+    // Un flujo de numeros aleatorios independiente por hilo, derivado de la semilla
+    unsigned int base = params.semilla == 0 ? random_device{}() : params.semilla;
+    vector<ILSResult> resultados(hilos);
+    vector<thread> trabajadores;
+    for (int h = 0; h < hilos; ++h) {
+        trabajadores.emplace_back([&, h]() {
+            seed_seq semillas{base, (unsigned int)h};
+            mt19937 rng(semillas);
+            resultados[h] = caminata_ils(solucion_inicial, ctx, rng);
+        });
+    }
+    for (auto& t : trabajadores) t.join();
+
+    ILSResult res;
+    res.mejor_makespan = incumbente.leer(res.mejor);
+    res.traza = incumbente.traza();
+    for (const auto& r : resultados) {
+        res.iteraciones += r.iteraciones;
+        res.reinicios += r.reinicios;
+        res.evaluaciones += r.evaluaciones;
+        res.evaluaciones_completas += r.evaluaciones_completas;
+        res.perfil.merge(r.perfil);
+    }
+    return res;
 }
@@ -1,12 +1,58 @@
 #ifndef ILS_H
 #define ILS_H
 
+#include "../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
+#include <random>
 #include <vector>
 
+// Presupuesto y parametros del ILS. Un limite en 0 significa "sin limite";
+// al menos uno de max_iters, tiempo_limite_ms o max_evaluaciones debe fijarse.
+struct ILSParams {
+    int max_iters = 0;
+    double tiempo_limite_ms = 0.0;
+    long long max_evaluaciones = 0;  // evaluaciones parciales (posiciones de insercion)
+    int fuerza = 5;            // swaps por perturbacion
+    int max_sin_mejora = 0;    // iteraciones sin mejorar la mejor antes de reiniciar (0 = nunca)
+    unsigned int semilla = 0;  // 0 = semilla aleatoria
+
+    // Solo para ILS_paralelo
+    int hilos = 0;             // 0 = std::thread::hardware_concurrency()
+    int max_retraso = 0;       // iteraciones por detras del incumbente antes de saltar a el (0 = nunca)
+};
+
+struct ILSResult {
+    std::vector<int> mejor;
+    int mejor_makespan = 0;
+    int iteraciones = 0;
+    int reinicios = 0;
+    long long evaluaciones = 0;            // parciales: posiciones de insercion de Taillard
+    long long evaluaciones_completas = 0;  // makespans de secuencias completas
+    // Traza "anytime": (tiempo, evaluaciones parciales, makespan) en cada mejora de la mejor solucion
+    ConvergenceTrace traza;
+    // Tiempo y evaluaciones por fase (make PROFILE=1): perturbacion (como mutacion),
+    // busqueda local, evaluacion y reinicios; en ILS_paralelo, sumado entre los hilos
+    PhaseProfile perfil;
+};
+
 std::vector<int> perturbacion_swap(std::vector<int> secuencia, int fuerza);
+std::vector<int> perturbacion_swap(std::vector<int> secuencia, int fuerza, std::mt19937& rng);
 std::vector<int> ILS(const std::vector<int>& solucion_inicial,
                      const std::vector<std::vector<int>>& tiempos,
                      int m,
                      int max_iters);
+ILSResult ILS_presupuesto(const std::vector<int>& solucion_inicial,
+                          const std::vector<std::vector<int>>& tiempos,
+                          int m,
+                          const ILSParams& params);
+
+// Multi-arranque en paralelo: un ILS independiente por hilo, cada uno con su propio
+// generador, que comparten el mejor makespan (atomico) y la mejor secuencia (seqlock).
+// Los limites de tiempo y de evaluaciones son globales; max_iters es por hilo.
+ILSResult ILS_paralelo(const std::vector<int>& solucion_inicial,
+                       const std::vector<std::vector<int>>& tiempos,
+                       int m,
+                       const ILSParams& params);
 
-#endif
\ No newline at end of file
+#endif
@@ -1,11 +1,13 @@
 #include "LS.h"
 #include "NEH.h"  // para usar calcular_makespan
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
 vector<int> local_search_insertion(vector<int> secuencia, 
                                    const vector<vector<int>>& tiempos, 
-                                   int m) {
+                                   int m,
+                                   long long* evaluaciones) {
     bool mejora = true;
     int n = secuencia.size();
 
@@ -24,6 +26,7 @@ vector<int> local_search_insertion(vector<int> secuencia,
                 vecino.erase(vecino.begin() + i);
                 vecino.insert(vecino.begin() + j, tarea);
                 int ms = calcular_makespan(vecino, tiempos, m);
+                if (evaluaciones) (*evaluaciones)++;
 
                 if (ms < mejor_makespan) {
                     // cout << "Consegui uno mejor" << endl;
@@ -39,3 +42,38 @@ vector<int> local_search_insertion(vector<int> secuencia,
 
     return secuencia;
 }
+
+// Busqueda local por insercion con la aceleracion de Taillard: cada tarea se extrae
+// y se reinserta en su mejor posicion (insertar_mejor_posicion). Se repite hasta que
+// una pasada completa no mejore el makespan. Si se pasa 'evaluaciones', se le suma
+// el numero de vecinos (posiciones de insercion) evaluados.
+vector<int> local_search_insertion_taillard(vector<int> secuencia,
+                                            const vector<vector<int>>& tiempos,
+                                            int m,
+                                            long long* evaluaciones) {
+    int n = secuencia.size();
+    if (n < 2) return secuencia;
+
+    int mejor_makespan = calcular_makespan(secuencia, tiempos, m);
+    bool mejora = true;
+
+    while (mejora) {
+        mejora = false;
+        vector<int> orden = secuencia;
+
+        for (int tarea : orden) {
+            vector<int> vecino = secuencia;
+            vecino.erase(find(vecino.begin(), vecino.end(), tarea));
+            int ms = insertar_mejor_posicion(vecino, tarea, tiempos, m);
+            if (evaluaciones) *evaluaciones += n;
+
+            if (ms < mejor_makespan) {
+                mejor_makespan = ms;
+                secuencia = vecino;
+                mejora = true;
+            }
+        }
+    }
+
+    return secuencia;
+}
@@ -3,6 +3,7 @@
 #include <numeric>
 #include <algorithm>
 #include "NEH.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
 
 using namespace std;
 
@@ -20,36 +21,53 @@ int calcular_makespan(const vector<int>& secuencia, const vector<vector<int>>& t
     return C[n_tareas][n_maquinas];
 }
 
-vector<int> neh(int n, int m, const vector<vector<int>>& tiempos) {
-    // Ordenar tareas por suma total de tiempos
-    vector<pair<int, int>> sum_tiempos;
-    for (int i = 0; i < n; ++i) {
-        int sum = accumulate(tiempos[i].begin(), tiempos[i].end(), 0);
-        sum_tiempos.push_back({sum, i});
+// Inserta 'tarea' en la posicion de 'secuencia' que minimiza el makespan y lo devuelve.
+// Usa la aceleracion de Taillard: con las cabezas e (prefijos), las colas q (sufijos)
+// y los tiempos f de la tarea insertada, cada posicion se evalua en O(m), por lo que
+// todas las posiciones se prueban en O(n*m) en lugar de O(n^2*m).
+int insertar_mejor_posicion(vector<int>& secuencia, int tarea, const vector<vector<int>>& tiempos, int n_maquinas) {
+    int k = secuencia.size();
+    int w = n_maquinas + 2;
+
+    // Filas 0..k+1 con bordes en cero para evitar casos especiales
+    vector<int> e((k + 2) * w, 0), q((k + 2) * w, 0);
+    for (int i = 1; i <= k; ++i) {
+        const vector<int>& p = tiempos[secuencia[i-1]];
+        for (int j = 1; j <= n_maquinas; ++j) {
+            e[i*w + j] = max(e[(i-1)*w + j], e[i*w + j-1]) + p[j-1];
+        }
     }
-    sort(sum_tiempos.begin(), sum_tiempos.end(), greater<pair<int, int>>());
-
-    vector<int> secuencia_actual;
-    int mejor_makespan_final = 0;
-
-    //Insercion iterativa de tareas
-    for (int i = 0; i < n; ++i) {
-        int tarea_actual = sum_tiempos[i].second;
-        int mejor_makespan_iteracion = 2e9;
-        vector<int> mejor_secuencia_iteracion;
-
-        for (int pos = 0; pos <= (int)secuencia_actual.size(); ++pos) {
-            vector<int> temp_secuencia = secuencia_actual;
-            temp_secuencia.insert(temp_secuencia.begin() + pos, tarea_actual);
-
-            int ms = calcular_makespan(temp_secuencia, tiempos, m);
-            if (ms < mejor_makespan_iteracion) {
-                mejor_makespan_iteracion = ms;
-                mejor_secuencia_iteracion = temp_secuencia;
-            }
+    for (int i = k; i >= 1; --i) {
+        const vector<int>& p = tiempos[secuencia[i-1]];
+        for (int j = n_maquinas; j >= 1; --j) {
+            q[i*w + j] = max(q[(i+1)*w + j], q[i*w + j+1]) + p[j-1];
+        }
+    }
+
+    const vector<int>& px = tiempos[tarea];
+    int mejor_pos = 0;
+    int mejor_makespan = 2e9;
+    for (int pos = 0; pos <= k; ++pos) {
+        // La tarea queda entre las filas pos (cabeza) y pos+1 (cola)
+        int f = 0;
+        int ms = 0;
+        for (int j = 1; j <= n_maquinas; ++j) {
+            f = max(f, e[pos*w + j]) + px[j-1];
+            ms = max(ms, f + q[(pos+1)*w + j]);
+        }
+        if (ms < mejor_makespan) {
+            mejor_makespan = ms;
+            mejor_pos = pos;
         }
-        secuencia_actual = mejor_secuencia_iteracion;
-        mejor_makespan_final = mejor_makespan_iteracion;
     }
-    return secuencia_actual;
-}
\ No newline at end of file
+
+    secuencia.insert(secuencia.begin() + mejor_pos, tarea);
+    return mejor_makespan;
+}
+
+// El orden de prioridad (suma de tiempos decreciente) y la inserción acelerada están
+// en InstanceAggregates; quien ya tenga los agregados de la instancia usa su
+// neh_sequence() directamente
+vector<int> neh(int n, int m, const vector<vector<int>>& tiempos) {
+    return InstanceAggregates(tiempos, n, m).neh_sequence();
+}
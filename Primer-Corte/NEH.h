@@ -5,5 +5,6 @@
 
 std::vector<int> neh(int n, int m, const std::vector<std::vector<int>>& tiempos);
 int calcular_makespan(const std::vector<int>& secuencia, const std::vector<std::vector<int>>& tiempos, int n_maquinas);
+int insertar_mejor_posicion(std::vector<int>& secuencia, int tarea, const std::vector<std::vector<int>>& tiempos, int n_maquinas);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,104 @@
+#include <iostream>
+#include <vector>
+#include <chrono>
+#include "BB.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+#include "SubsetDP.h"
+
+using namespace std;
+
+// Datos de ejemplo (matriz 20x5, la misma del Branch and Bound 1)
+static vector<vector<int>> example_instance() {
+    return {
+        {5, 1, 1, 6, 14},
+        {11, 27, 9, 8, 15},
+        {3, 3, 28, 10, 27},
+        {4, 8, 21, 8, 22},
+        {20, 6, 30, 5, 21},
+        {24, 19, 19, 29, 5},
+        {5, 15, 28, 16, 30},
+        {16, 3, 22, 11, 30},
+        {27, 8, 25, 9, 6},
+        {26, 7, 2, 16, 27},
+        {13, 26, 17, 9, 13},
+        {11, 17, 23, 19, 3},
+        {12, 6, 13, 27, 6},
+        {8, 4, 15, 15, 25},
+        {6, 23, 16, 30, 26},
+        {13, 19, 25, 27, 23},
+        {27, 26, 19, 15, 25},
+        {17, 16, 9, 20, 29},
+        {19, 27, 28, 22, 12},
+        {8, 14, 7, 1, 17}
+    };
+}
+
+// Función para medir tiempo de ejecución
+void measure_execution_time(const FlatInstance& instance, const DPParams& params) {
+
+    // La DP lee la matriz plana máquinas x trabajos de la instancia, sin armar filas
+    cout << "Matriz: " << instance.n << " trabajos x " << instance.m << " máquinas" << endl;
+
+    auto start = chrono::high_resolution_clock::now();
+    auto result = subset_dp(instance.machine_major(), instance.n, instance.m, params);
+    auto end = chrono::high_resolution_clock::now();
+    auto duration = chrono::duration_cast<chrono::milliseconds>(end - start);
+
+    cout << "\n=== RESULTADOS ===" << endl;
+    cout << "Mejor secuencia encontrada: ";
+    for (int job : result.sequence) {
+        cout << job << " ";
+    }
+    cout << endl;
+
+    cout << "Makespan: " << result.makespan << endl;
+    print_dp_stats(result);
+    cout << "Tiempo de ejecución: " << duration.count() << " ms" << endl;
+
+    if (result.sequence.empty()) {
+        cout << "No existe una secuencia con makespan menor o igual a la cota superior dada" << endl;
+        return;
+    }
+
+    // Verificar secuencia con cálculo directo
+    cout << "\n=== VERIFICACIÓN ===" << endl;
+    int calculated = sequence_makespan(instance.machine_major(), instance.n, instance.m, result.sequence);
+    cout << "Makespan calculado para la secuencia: " << calculated << endl;
+    if (calculated == result.makespan) {
+        cout << "✓ Verificación exitosa" << endl;
+    } else {
+        cout << "✗ Error en la verificación" << endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    DPParams params;
+    vector<string> paths;
+    if (!parse_dp_args(argc, argv, params, &paths)) return 1;
+
+    cout << "==========================================" << endl;
+    cout << "PROGRAMACIÓN DINÁMICA SOBRE SUBCONJUNTOS PARA PFSP" << endl;
+    cout << "==========================================" << endl;
+
+    // Sin rutas de instancias se usa la matriz de ejemplo
+    if (paths.empty()) {
+        vector<vector<int>> example = example_instance();
+        measure_execution_time(flatten_instance("ejemplo", example.size(), example[0].size(), 0, example), params);
+    } else {
+        vector<FlatInstance> instances;
+        load_instances(paths, instances);
+        for (const auto& instance : instances) {
+            cout << "\nInstancia: " << instance.name << endl;
+            params.aggregates = &instance.aggregates();
+            measure_execution_time(instance, params);
+        }
+        if (instances.empty()) return 1;
+    }
+
+    cout << "\n==========================================" << endl;
+    cout << "Nota: la memoria crece con C(n, n/2) subconjuntos;" << endl;
+    cout << "pensado para n <= " << DP_MAX_JOBS << " trabajos." << endl;
+    cout << "==========================================" << endl;
+
+    return 0;
+}
@@ -0,0 +1,409 @@
+#include "SubsetDP.h"
+#include "BB.h"
+#include "NEH.h"
+#include "LS.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+
+using namespace std;
+
+/*
+La capa k tiene un bloque por cada subconjunto de k trabajos. Los subconjuntos se
+indexan por su rango en el sistema combinatorio (colex):
+    rango({c_1 < c_2 < ... < c_k}) = C(c_1, 1) + C(c_2, 2) + ... + C(c_k, k)
+así que la capa ocupa exactamente C(n, k) bloques, sin tablas hash ni huecos. offset[r]
+indica dónde empiezan las entradas del subconjunto de rango r, y cada entrada guarda
+su columna (M enteros), el último trabajo y el índice de la entrada padre en la capa
+anterior, con lo que se reconstruye la secuencia al final.
+
+La capa k se calcula "hacia atrás": cada subconjunto S mira a S \ {j} para cada j en S.
+Así cada subconjunto se resuelve sin tocar los demás y los de una misma cardinalidad
+se reparten entre hilos sin bloqueos. Las columnas de la capa k - 1 se liberan al
+terminar la capa k; de las anteriores solo quedan trabajo y padre.
+*/
+
+namespace {
+
+struct Layer {
+    vector<uint64_t> offset;     // C(n, k) + 1
+    vector<int> columns;         // entradas x M
+    vector<uint8_t> last_job;
+    vector<uint32_t> parent;     // índice en la capa anterior
+
+    size_t size() const { return last_job.size(); }
+};
+
+// Salida de un bloque consecutivo de rangos, calculado por un hilo
+struct ChunkOut {
+    vector<uint32_t> counts;     // entradas por subconjunto
+    vector<int> columns;
+    vector<uint8_t> last_job;
+    vector<uint32_t> parent;
+    long long generated = 0;
+    long long bound_prunes = 0;
+    long long dominated = 0;
+    int max_front = 0;
+
+    size_t bytes() const {
+        return counts.capacity() * sizeof(uint32_t) + columns.capacity() * sizeof(int) +
+               last_job.capacity() + parent.capacity() * sizeof(uint32_t);
+    }
+};
+
+const uint64_t CHUNK_SUBSETS = 1024;
+
+struct DPContext {
+    const BBInstance& inst;
+    int best;                            // incumbente: solo se guardan columnas con cota menor
+    vector<vector<uint64_t>> binom;      // binom[a][b] = C(a, b)
+    vector<int> tail;                    // tail[m * N + j] = suma de p[l][j] con l > m
+    size_t memory_limit;
+
+    DPContext(const BBInstance& i, int incumbent, size_t limit)
+        : inst(i), best(incumbent), binom(i.num_jobs + 1, vector<uint64_t>(i.num_jobs + 2, 0)),
+          tail(i.num_machines * i.num_jobs, 0), memory_limit(limit) {
+        const int N = inst.num_jobs;
+        const int M = inst.num_machines;
+        for (int a = 0; a <= N; a++) {
+            binom[a][0] = 1;
+            for (int b = 1; b <= a; b++) binom[a][b] = binom[a - 1][b - 1] + binom[a - 1][b];
+        }
+        for (int j = 0; j < N; j++) {
+            for (int m = M - 2; m >= 0; m--) tail[m * N + j] = tail[(m + 1) * N + j] + inst.time(m + 1, j);
+        }
+    }
+
+    uint64_t rank(uint32_t mask) const {
+        uint64_t r = 0;
+        int i = 1;
+        for (int c = 0; mask; c++, mask >>= 1) {
+            if (mask & 1) r += binom[c][i++];
+        }
+        return r;
+    }
+
+    uint32_t unrank(uint64_t r, int k) const {
+        uint32_t mask = 0;
+        int c = inst.num_jobs - 1;
+        for (int i = k; i >= 1; i--) {
+            while (binom[c][i] > r) c--;
+            mask |= 1u << c;
+            r -= binom[c][i];
+            c--;
+        }
+        return mask;
+    }
+};
+
+// Siguiente subconjunto con la misma cantidad de bits (orden colex = orden de rango)
+inline uint32_t next_subset(uint32_t v) {
+    uint32_t t = v | (v - 1);
+    return (t + 1) | (((~t & (0u - ~t)) - 1) >> (__builtin_ctz(v) + 1));
+}
+
+inline bool dominates(const int* a, const int* b, int M) {
+    for (int m = 0; m < M; m++) {
+        if (a[m] > b[m]) return false;
+    }
+    return true;
+}
+
+// Frente de Pareto de un subconjunto
+void solve_subset(const DPContext& ctx, const Layer& prev, uint32_t mask, int k,
+                  ChunkOut& out, vector<int>& child, vector<int>& R, vector<int>& pmin, vector<int>& qmin) {
+    const BBInstance& inst = ctx.inst;
+    const int N = inst.num_jobs;
+    const int M = inst.num_machines;
+
+    // Trabajo restante por máquina, tiempo mínimo y cola mínima de los trabajos fuera de S
+    for (int m = 0; m < M; m++) {
+        R[m] = inst.machine_work[m];
+        pmin[m] = k < N ? INT_MAX : 0;
+        qmin[m] = k < N ? INT_MAX : 0;
+    }
+    for (int j = 0; j < N; j++) {
+        if (mask >> j & 1) {
+            for (int m = 0; m < M; m++) R[m] -= inst.time(m, j);
+        } else {
+            for (int m = 0; m < M; m++) {
+                pmin[m] = min(pmin[m], inst.time(m, j));
+                qmin[m] = min(qmin[m], ctx.tail[m * N + j]);
+            }
+        }
+    }
+
+    size_t start = out.last_job.size();
+    for (int j = 0; j < N; j++) {
+        if (!(mask >> j & 1)) continue;
+        uint64_t pr = ctx.rank(mask & ~(1u << j));
+        for (uint64_t e = prev.offset[pr]; e < prev.offset[pr + 1]; e++) {
+            const int* col = &prev.columns[e * M];
+            // Cota LB1: la máquina m no empieza lo que falta antes de que el primero
+            // de los restantes pase por m - 1 (cabeza h), ni termina antes de su cola
+            int c = 0;
+            int h = 0;
+            int lb = 0;
+            for (int m = 0; m < M; m++) {
+                c = max(c, col[m]) + inst.time(m, j);
+                child[m] = c;
+                h = m > 0 ? max(c, h + pmin[m - 1]) : c;
+                lb = max(lb, h + R[m] + qmin[m]);
+            }
+            out.generated++;
+            if (lb >= ctx.best) {
+                out.bound_prunes++;
+                continue;
+            }
+
+            // Descartar si alguna columna del frente la domina; si no, quitar las que ella domina
+            size_t f = out.last_job.size();
+            bool dominated = false;
+            for (size_t i = start; i < f && !dominated; i++) {
+                dominated = dominates(&out.columns[i * M], child.data(), M);
+            }
+            if (dominated) {
+                out.dominated++;
+                continue;
+            }
+            for (size_t i = start; i < f;) {
+                if (dominates(child.data(), &out.columns[i * M], M)) {
+                    f--;
+                    copy(&out.columns[f * M], &out.columns[f * M] + M, &out.columns[i * M]);
+                    out.last_job[i] = out.last_job[f];
+                    out.parent[i] = out.parent[f];
+                    out.dominated++;
+                } else {
+                    i++;
+                }
+            }
+            out.columns.resize(f * M);
+            out.last_job.resize(f);
+            out.parent.resize(f);
+            out.columns.insert(out.columns.end(), child.begin(), child.end());
+            out.last_job.push_back(j);
+            out.parent.push_back(e);
+        }
+    }
+    uint32_t size = out.last_job.size() - start;
+    out.counts.push_back(size);
+    out.max_front = max(out.max_front, (int)size);
+}
+
+size_t layer_bytes(const Layer& layer) {
+    return layer.offset.capacity() * sizeof(uint64_t) + layer.columns.capacity() * sizeof(int) +
+           layer.last_job.capacity() + layer.parent.capacity() * sizeof(uint32_t);
+}
+
+}  // namespace
+
+DPResult subset_dp(const vector<vector<int>>& processing_times, const DPParams& params) {
+    int num_machines = processing_times.size();
+    int num_jobs = num_machines > 0 ? processing_times[0].size() : 0;
+    vector<int> flat = machine_major_matrix(processing_times);
+    return subset_dp(flat.data(), num_jobs, num_machines, params);
+}
+
+DPResult subset_dp(const int* machine_major, int num_jobs, int num_machines, const DPParams& params) {
+    DPResult result;
+    const int N = num_jobs;
+    const int M = num_machines;
+    if (N > DP_MAX_JOBS) {
+        cerr << "Programación dinámica: como máximo " << DP_MAX_JOBS << " trabajos" << endl;
+        return result;
+    }
+
+    unique_ptr<InstanceAggregates> local_aggregates;
+    const InstanceAggregates& aggregates = aggregates_or_build(params.aggregates, local_aggregates, machine_major,
+                                                               N, M, MatrixLayout::MachineMajor);
+    BBInstance inst = make_bb_instance(machine_major, N, M, aggregates);
+
+    // Incumbente inicial, como en el B&B
+    int best = INT_MAX;
+    vector<int> best_sequence;
+    if (params.upper_bound != INT_MAX) best = params.upper_bound + 1;
+    if (params.neh_incumbent && N > 0) {
+        vector<int> secuencia = aggregates.neh_sequence();
+        int makespan = aggregates.neh_makespan();
+        if (params.local_search) {
+            vector<vector<int>> tiempos(N, vector<int>(M));
+            for (int j = 0; j < N; j++) {
+                for (int m = 0; m < M; m++) tiempos[j][m] = inst.time(m, j);
+            }
+            secuencia = local_search_insertion_taillard(secuencia, tiempos, M);
+            makespan = sequence_makespan(inst.p.data(), N, M, secuencia);
+        }
+        if (makespan < best) {
+            best = makespan;
+            best_sequence = secuencia;
+        }
+    }
+    result.initial_upper_bound = best_sequence.empty() ? params.upper_bound : best;
+
+    int threads = params.threads > 0 ? params.threads : max(1u, thread::hardware_concurrency());
+    DPContext ctx(inst, best, params.memory_limit_mb * 1024 * 1024);
+
+    // Capa 0: el subconjunto vacío con la columna en cero
+    vector<Layer> layers(N + 1);
+    layers[0].offset = {0, 1};
+    layers[0].columns.assign(M, 0);
+    layers[0].last_job.assign(1, 0);
+    layers[0].parent.assign(1, 0);
+    result.layer_states.assign(N + 1, 0);
+    result.layer_states[0] = 1;
+
+    bool out_of_memory = false;
+    int k = 1;
+    for (; k <= N; k++) {
+        const Layer& prev = layers[k - 1];
+        const uint64_t subsets = ctx.binom[N][k];
+        const uint64_t num_chunks = (subsets + CHUNK_SUBSETS - 1) / CHUNK_SUBSETS;
+        vector<ChunkOut> chunks(num_chunks);
+        atomic<uint64_t> next_chunk(0);
+        atomic<size_t> pending_bytes(0);
+        atomic<bool> stop(false);
+        size_t base_bytes = 0;
+        for (int l = 0; l < k; l++) base_bytes += layer_bytes(layers[l]);
+
+        auto worker = [&]() {
+            vector<int> child(M), R(M), pmin(M), qmin(M);
+            for (uint64_t c; !stop.load(memory_order_relaxed) && (c = next_chunk.fetch_add(1)) < num_chunks;) {
+                ChunkOut& out = chunks[c];
+                uint64_t first = c * CHUNK_SUBSETS;
+                uint64_t last = min(subsets, first + CHUNK_SUBSETS);
+                uint32_t mask = ctx.unrank(first, k);
+                for (uint64_t r = first; r < last; r++, mask = r < last ? next_subset(mask) : mask) {
+                    solve_subset(ctx, prev, mask, k, out, child, R, pmin, qmin);
+                }
+                // Al unir los bloques la capa existe dos veces: se cuenta el doble
+                size_t pending = pending_bytes.fetch_add(out.bytes()) + out.bytes();
+                if (base_bytes + 2 * pending > ctx.memory_limit) stop = true;
+            }
+        };
+        vector<thread> pool;
+        for (int t = 1; t < threads; t++) pool.emplace_back(worker);
+        worker();
+        for (thread& t : pool) t.join();
+        result.peak_memory_bytes = max(result.peak_memory_bytes, base_bytes + pending_bytes.load());
+        if (stop) {
+            out_of_memory = true;
+            break;
+        }
+
+        // Unir los bloques en orden de rango (el resultado no depende de los hilos)
+        Layer& layer = layers[k];
+        layer.offset.assign(subsets + 1, 0);
+        size_t entries = 0;
+        for (const ChunkOut& out : chunks) entries += out.last_job.size();
+        layer.columns.reserve(entries * M);
+        layer.last_job.reserve(entries);
+        layer.parent.reserve(entries);
+        result.peak_memory_bytes = max(result.peak_memory_bytes,
+                                       base_bytes + pending_bytes.load() + layer_bytes(layer));
+        uint64_t r = 0;
+        for (ChunkOut& out : chunks) {
+            for (uint32_t count : out.counts) {
+                layer.offset[r + 1] = layer.offset[r] + count;
+                r++;
+            }
+            layer.columns.insert(layer.columns.end(), out.columns.begin(), out.columns.end());
+            layer.last_job.insert(layer.last_job.end(), out.last_job.begin(), out.last_job.end());
+            layer.parent.insert(layer.parent.end(), out.parent.begin(), out.parent.end());
+            result.generated += out.generated;
+            result.bound_prunes += out.bound_prunes;
+            result.dominated += out.dominated;
+            result.max_front = max(result.max_front, out.max_front);
+            vector<uint32_t>().swap(out.counts);
+            vector<int>().swap(out.columns);
+            vector<uint8_t>().swap(out.last_job);
+            vector<uint32_t>().swap(out.parent);
+        }
+        result.layer_states[k] = entries;
+        result.states += entries;
+
+        // La capa anterior ya no se consulta por rango ni por columna
+        Layer& old = layers[k - 1];
+        vector<uint64_t>().swap(old.offset);
+        vector<int>().swap(old.columns);
+
+        // Ningún prefijo de k trabajos mejora el incumbente: ya es óptimo
+        if (entries == 0) break;
+    }
+
+    result.complete = !out_of_memory;
+    const Layer& full = layers[N];
+    if (!out_of_memory && k > N && full.size() > 0) {
+        size_t e_best = 0;
+        for (size_t e = 1; e < full.size(); e++) {
+            if (full.columns[e * M + M - 1] < full.columns[e_best * M + M - 1]) e_best = e;
+        }
+        best = full.columns[e_best * M + M - 1];
+        best_sequence.assign(N, -1);
+        size_t e = e_best;
+        for (int l = N; l >= 1; l--) {
+            best_sequence[l - 1] = layers[l].last_job[e];
+            e = layers[l].parent[e];
+        }
+    }
+
+    result.sequence = best_sequence;
+    result.makespan = best_sequence.empty() ? 0 : best;
+    return result;
+}
+
+static void print_dp_usage(const char* program) {
+    cerr << "Uso: " << program << " [INSTANCIAS...] [--no-neh] [--no-ls] [--ub=N] [--threads=N] [--memory-mb=N]" << endl;
+}
+
+bool parse_dp_args(int argc, char** argv, DPParams& params, vector<string>* instance_paths) {
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        if (instance_paths && !arg.empty() && arg[0] != '-') {
+            instance_paths->push_back(arg);
+        } else if (arg == "--no-neh") {
+            params.neh_incumbent = false;
+        } else if (arg == "--no-ls") {
+            params.local_search = false;
+        } else if (arg.find('=') != string::npos) {
+            // Opciones numéricas: --nombre=N
+            string name = arg.substr(0, arg.find('='));
+            int value;
+            try {
+                value = stoi(arg.substr(arg.find('=') + 1));
+            } catch (const exception&) {
+                print_dp_usage(argv[0]);
+                return false;
+            }
+            if (name == "--ub") params.upper_bound = value;
+            else if (name == "--threads") params.threads = value;
+            else if (name == "--memory-mb") params.memory_limit_mb = max(0, value);
+            else { print_dp_usage(argv[0]); return false; }
+        } else {
+            print_dp_usage(argv[0]);
+            return false;
+        }
+    }
+    return true;
+}
+
+void print_dp_stats(const DPResult& result) {
+    if (result.initial_upper_bound != INT_MAX) {
+        cout << "Cota superior inicial: " << result.initial_upper_bound << endl;
+    }
+    cout << "Columnas generadas: " << result.generated << ", podadas por cota "
+         << result.bound_prunes << ", dominadas " << result.dominated << endl;
+    cout << "Estados guardados: " << result.states << " (frente máximo " << result.max_front
+         << "), " << result.peak_memory_bytes / 1024 << " KB de memoria pico" << endl;
+    for (int k = 1; k < (int)result.layer_states.size(); k++) {
+        if (result.layer_states[k] == 0) continue;
+        cout << "  " << k << " trabajos: " << result.layer_states[k] << " estados" << endl;
+    }
+    if (!result.complete) {
+        cout << "Memoria agotada: la solución es el incumbente, sin garantía de optimalidad" << endl;
+    }
+}
@@ -0,0 +1,62 @@
+#ifndef SUBSET_DP_H
+#define SUBSET_DP_H
+
+#include <climits>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Programación dinámica sobre subconjuntos de trabajos, alternativa exacta al B&B
+// para instancias pequeñas (n <= DP_MAX_JOBS). Cada subconjunto S guarda el frente de
+// Pareto de las columnas de finalización de sus órdenes: si una columna es menor o
+// igual en todas las máquinas que otra, la otra no puede llevar a un mejor makespan.
+// Todos los órdenes de S que llegan a la misma columna se funden en un solo estado.
+const int DP_MAX_JOBS = 24;
+
+class InstanceAggregates;
+
+struct DPParams {
+    // Cota superior inicial: NEH, opcionalmente mejorado con búsqueda local de inserción
+    bool neh_incumbent = true;
+    bool local_search = true;
+    int upper_bound = INT_MAX;       // igual que en BBParams
+    const InstanceAggregates* aggregates = nullptr;   // igual que en BBParams
+
+    // Hilos que reparten los subconjuntos de cada cardinalidad (0 = todos los núcleos)
+    int threads = 1;
+
+    // Tope de memoria del almacén de estados. Si se supera, la DP se detiene y
+    // devuelve el incumbente sin garantía de optimalidad.
+    std::size_t memory_limit_mb = 1024;
+};
+
+struct DPResult {
+    std::vector<int> sequence;
+    int makespan = 0;
+    int initial_upper_bound = INT_MAX;
+    bool complete = false;           // false si se agotó la memoria
+
+    long long generated = 0;         // columnas derivadas
+    long long bound_prunes = 0;      // descartadas por la cota contra el incumbente
+    long long dominated = 0;         // descartadas por dominancia de Pareto
+    long long states = 0;            // columnas guardadas en total
+    int max_front = 0;               // frente más grande de un subconjunto
+    std::vector<long long> layer_states;   // columnas guardadas por cardinalidad
+    std::size_t peak_memory_bytes = 0;
+};
+
+DPResult subset_dp(const std::vector<std::vector<int>>& processing_times,
+                   const DPParams& params = DPParams());
+// Desde la matriz plana máquinas x trabajos (FlatInstance::machine_major)
+DPResult subset_dp(const int* machine_major, int num_jobs, int num_machines,
+                   const DPParams& params = DPParams());
+
+// Lee las opciones de la DP (--no-neh, --no-ls, --ub=N, --threads=N, --memory-mb=N).
+// Los argumentos que no empiezan con '-' son rutas de instancias y se guardan en
+// instance_paths (si es null, son un error). Devuelve false y muestra la ayuda si hay un error.
+bool parse_dp_args(int argc, char** argv, DPParams& params,
+                   std::vector<std::string>* instance_paths = nullptr);
+
+void print_dp_stats(const DPResult& result);
+
+#endif
@@ -4,34 +4,12 @@
 #include "LS.h"
 #include "ILS.h"
 #include <chrono>
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 using namespace std;
 
-int main() {
-    int n = 20, m = 5;
-
-    vector<vector<int>> tiempos = {
-    { 2, 20, 28, 27,  3},
-    {26,  2,  1, 30, 27},
-    { 7, 15, 20,  9, 11},
-    {11, 22, 22, 10, 29},
-    {10,  7, 12,  8, 10},
-    {19, 21,  6,  7, 12},
-    { 1,  9, 28, 29, 29},
-    {13, 30, 24, 10, 14},
-    { 7, 22, 16, 29, 30},
-    {14,  6,  1, 30,  3},
-    { 9, 29, 27, 27,  6},
-    { 6,  6, 28, 19, 24},
-    {27,  6, 21, 26, 26},
-    {13,  3, 13, 29,  8},
-    {25, 24,  5, 28, 10},
-    {27, 13, 12, 17,  1},
-    {30, 10,  1, 20, 15},
-    { 5, 23, 28,  2,  1},
-    {18, 23, 29, 18,  2},
-    {19, 20, 20, 23, 18}
-};
+// NEH, búsqueda local e ILS sobre una instancia (tiempos[j][k])
+static void ejecutar(int n, int m, const vector<vector<int>>& tiempos) {
     // NEH con medición de tiempo
     auto inicio_neh = chrono::high_resolution_clock::now();
     vector<int> secuencia_inicial = neh(n, m, tiempos);
@@ -66,4 +44,44 @@ int main() {
     for (int t : secuencia_ils) cout << t+1 << " ";
     cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
     cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
-}
\ No newline at end of file
+}
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, la matriz de ejemplo
+    vector<string> rutas = instance_paths_from_args(argc, argv);
+    if (!rutas.empty()) {
+        vector<FlatInstance> instancias;
+        load_instances(rutas, instancias);
+        for (const auto& instancia : instancias) {
+            cout << "Instancia: " << instancia.name << " (n=" << instancia.n << ", m=" << instancia.m << ")" << endl;
+            ejecutar(instancia.n, instancia.m, instancia.job_rows());
+        }
+        return instancias.empty() ? 1 : 0;
+    }
+
+    int n = 20, m = 5;
+
+    vector<vector<int>> tiempos = {
+    { 2, 20, 28, 27,  3},
+    {26,  2,  1, 30, 27},
+    { 7, 15, 20,  9, 11},
+    {11, 22, 22, 10, 29},
+    {10,  7, 12,  8, 10},
+    {19, 21,  6,  7, 12},
+    { 1,  9, 28, 29, 29},
+    {13, 30, 24, 10, 14},
+    { 7, 22, 16, 29, 30},
+    {14,  6,  1, 30,  3},
+    { 9, 29, 27, 27,  6},
+    { 6,  6, 28, 19, 24},
+    {27,  6, 21, 26, 26},
+    {13,  3, 13, 29,  8},
+    {25, 24,  5, 28, 10},
+    {27, 13, 12, 17,  1},
+    {30, 10,  1, 20, 15},
+    { 5, 23, 28,  2,  1},
+    {18, 23, 29, 18,  2},
+    {19, 20, 20, 23, 18}
+};
+    ejecutar(n, m, tiempos);
+}
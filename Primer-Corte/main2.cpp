@@ -4,34 +4,12 @@
 #include "LS.h"
 #include "ILS.h"
 #include <chrono> 
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 using namespace std;
 
-int main() {
-    int n = 20, m = 10;
-
-    vector<vector<int>> tiempos = {
-    { 3, 18, 19,  2, 16, 18, 19, 23, 25,  1},
-    {21, 14,  2,  8,  7, 27,  7,  4, 11, 19},
-    { 5, 10,  9, 19, 11, 12, 29, 10,  8, 27},
-    {21, 21, 15, 17, 19, 25,  7, 22, 13, 18},
-    {25, 16, 12, 12,  8, 14, 29, 14, 12,  9},
-    { 6, 25, 10, 15, 20, 15, 28,  6, 25, 22},
-    {22,  2,  8, 16, 23, 21, 24, 27, 23,  6},
-    {18, 17, 20, 14,  5, 21, 30, 18,  6, 14},
-    {27, 24, 10, 11, 28,  2, 24, 12,  5, 27},
-    { 1,  3,  8, 11, 11,  9, 22,  7, 22, 16},
-    {21,  3, 30, 19, 16,  5, 19,  9, 10, 15},
-    {20,  5,  6,  8,  6,  5, 10, 12,  2,  1},
-    { 4, 11,  6, 17, 19, 13, 26, 16,  9, 20},
-    {16,  6, 17, 13,  5, 17, 30, 25, 13, 16},
-    { 2, 16, 28, 21, 13, 21, 10, 30, 23, 11},
-    {20, 30, 11, 18,  7, 16, 23,  6, 21, 30},
-    {12, 28,  1,  3, 20, 21, 28,  8,  7,  1},
-    {13,  2, 17, 30,  5, 17, 16, 10, 17, 14},
-    {16, 21,  3,  9, 22, 23, 22,  2, 12, 28},
-    {10, 21, 27, 10, 19, 23, 25, 16,  7, 27}
-};
+// NEH, búsqueda local e ILS sobre una instancia (tiempos[j][k])
+static void ejecutar(int n, int m, const vector<vector<int>>& tiempos) {
 
     // NEH con medición de tiempo
     auto inicio_neh = chrono::high_resolution_clock::now();
@@ -67,4 +45,44 @@ int main() {
     for (int t : secuencia_ils) cout << t+1 << " ";
     cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
     cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
-}
\ No newline at end of file
+}
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, la matriz de ejemplo
+    vector<string> rutas = instance_paths_from_args(argc, argv);
+    if (!rutas.empty()) {
+        vector<FlatInstance> instancias;
+        load_instances(rutas, instancias);
+        for (const auto& instancia : instancias) {
+            cout << "Instancia: " << instancia.name << " (n=" << instancia.n << ", m=" << instancia.m << ")" << endl;
+            ejecutar(instancia.n, instancia.m, instancia.job_rows());
+        }
+        return instancias.empty() ? 1 : 0;
+    }
+
+    int n = 20, m = 10;
+
+    vector<vector<int>> tiempos = {
+    { 3, 18, 19,  2, 16, 18, 19, 23, 25,  1},
+    {21, 14,  2,  8,  7, 27,  7,  4, 11, 19},
+    { 5, 10,  9, 19, 11, 12, 29, 10,  8, 27},
+    {21, 21, 15, 17, 19, 25,  7, 22, 13, 18},
+    {25, 16, 12, 12,  8, 14, 29, 14, 12,  9},
+    { 6, 25, 10, 15, 20, 15, 28,  6, 25, 22},
+    {22,  2,  8, 16, 23, 21, 24, 27, 23,  6},
+    {18, 17, 20, 14,  5, 21, 30, 18,  6, 14},
+    {27, 24, 10, 11, 28,  2, 24, 12,  5, 27},
+    { 1,  3,  8, 11, 11,  9, 22,  7, 22, 16},
+    {21,  3, 30, 19, 16,  5, 19,  9, 10, 15},
+    {20,  5,  6,  8,  6,  5, 10, 12,  2,  1},
+    { 4, 11,  6, 17, 19, 13, 26, 16,  9, 20},
+    {16,  6, 17, 13,  5, 17, 30, 25, 13, 16},
+    { 2, 16, 28, 21, 13, 21, 10, 30, 23, 11},
+    {20, 30, 11, 18,  7, 16, 23,  6, 21, 30},
+    {12, 28,  1,  3, 20, 21, 28,  8,  7,  1},
+    {13,  2, 17, 30,  5, 17, 16, 10, 17, 14},
+    {16, 21,  3,  9, 22, 23, 22,  2, 12, 28},
+    {10, 21, 27, 10, 19, 23, 25, 16,  7, 27}
+};
+    ejecutar(n, m, tiempos);
+}
@@ -4,10 +4,61 @@
 #include "LS.h"
 #include "ILS.h"
 #include <chrono>
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 using namespace std;
 
-int main() {
+// NEH, búsqueda local e ILS sobre una instancia (tiempos[j][k])
+static void ejecutar(int n, int m, const vector<vector<int>>& tiempos) {
+    // NEH con medición de tiempo
+    auto inicio_neh = chrono::high_resolution_clock::now();
+    vector<int> secuencia_inicial = neh(n, m, tiempos);
+    auto fin_neh = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_neh = fin_neh - inicio_neh;
+
+    cout << "Secuencia NEH: ";
+    for (int t : secuencia_inicial) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_inicial, tiempos, m) << endl;
+    cout << "Tiempo NEH: " << tiempo_neh.count() << " segundos" << endl;
+    cout << "\n";
+
+    // LS con medición de tiempo
+    auto inicio_ls = chrono::high_resolution_clock::now();
+    vector<int> secuencia_ls = local_search_insertion(secuencia_inicial, tiempos, m);
+    auto fin_ls = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_ls = fin_ls - inicio_ls;
+
+    cout << "Secuencia LocalSearch: ";
+    for (int t : secuencia_ls) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_ls, tiempos, m) << endl;
+    cout << "Tiempo LS: " << tiempo_ls.count() << " segundos" << endl;
+    cout << "\n";
+
+    // ILS con medición de tiempo
+    auto inicio_ils = chrono::high_resolution_clock::now();
+    vector<int> secuencia_ils = ILS(secuencia_inicial, tiempos, m, 30);
+    auto fin_ils = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_ils = fin_ils - inicio_ils;
+
+    cout << "Secuencia IterativeLocalSearch: ";
+    for (int t : secuencia_ils) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
+    cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
+}
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, la matriz de ejemplo
+    vector<string> rutas = instance_paths_from_args(argc, argv);
+    if (!rutas.empty()) {
+        vector<FlatInstance> instancias;
+        load_instances(rutas, instancias);
+        for (const auto& instancia : instancias) {
+            cout << "Instancia: " << instancia.name << " (n=" << instancia.n << ", m=" << instancia.m << ")" << endl;
+            ejecutar(instancia.n, instancia.m, instancia.job_rows());
+        }
+        return instancias.empty() ? 1 : 0;
+    }
+
     int n = 50, m = 10;
 
     vector<vector<int>> tiempos = {
@@ -62,38 +113,5 @@ int main() {
     {21,  6, 10, 17,  6,  3, 10, 22,  5, 23},
     {21,  1, 13, 26, 23,  9, 10, 14,  7,  1}
 };
-    // NEH con medición de tiempo
-    auto inicio_neh = chrono::high_resolution_clock::now();
-    vector<int> secuencia_inicial = neh(n, m, tiempos);
-    auto fin_neh = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_neh = fin_neh - inicio_neh;
-
-    cout << "Secuencia NEH: ";
-    for (int t : secuencia_inicial) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_inicial, tiempos, m) << endl;
-    cout << "Tiempo NEH: " << tiempo_neh.count() << " segundos" << endl;
-    cout << "\n";
-
-    // LS con medición de tiempo
-    auto inicio_ls = chrono::high_resolution_clock::now();
-    vector<int> secuencia_ls = local_search_insertion(secuencia_inicial, tiempos, m);
-    auto fin_ls = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_ls = fin_ls - inicio_ls;
-
-    cout << "Secuencia LocalSearch: ";
-    for (int t : secuencia_ls) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_ls, tiempos, m) << endl;
-    cout << "Tiempo LS: " << tiempo_ls.count() << " segundos" << endl;
-    cout << "\n";
-
-    // ILS con medición de tiempo
-    auto inicio_ils = chrono::high_resolution_clock::now();
-    vector<int> secuencia_ils = ILS(secuencia_inicial, tiempos, m, 30);
-    auto fin_ils = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_ils = fin_ils - inicio_ils;
-
-    cout << "Secuencia IterativeLocalSearch: ";
-    for (int t : secuencia_ils) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
-    cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
-}
\ No newline at end of file
+    ejecutar(n, m, tiempos);
+}
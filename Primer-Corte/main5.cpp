@@ -4,10 +4,61 @@
 #include "LS.h"
 #include "ILS.h"
 #include <chrono>
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 using namespace std;
 
-int main() {
+// NEH, búsqueda local e ILS sobre una instancia (tiempos[j][k])
+static void ejecutar(int n, int m, const vector<vector<int>>& tiempos) {
+        // NEH con medición de tiempo
+    auto inicio_neh = chrono::high_resolution_clock::now();
+    vector<int> secuencia_inicial = neh(n, m, tiempos);
+    auto fin_neh = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_neh = fin_neh - inicio_neh;
+
+    cout << "Secuencia NEH: ";
+    for (int t : secuencia_inicial) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_inicial, tiempos, m) << endl;
+    cout << "Tiempo NEH: " << tiempo_neh.count() << " segundos" << endl;
+    cout << "\n";
+
+    // LS con medición de tiempo
+    auto inicio_ls = chrono::high_resolution_clock::now();
+    vector<int> secuencia_ls = local_search_insertion(secuencia_inicial, tiempos, m);
+    auto fin_ls = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_ls = fin_ls - inicio_ls;
+
+    cout << "Secuencia LocalSearch: ";
+    for (int t : secuencia_ls) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_ls, tiempos, m) << endl;
+    cout << "Tiempo LS: " << tiempo_ls.count() << " segundos" << endl;
+    cout << "\n";
+
+    // ILS con medición de tiempo
+    auto inicio_ils = chrono::high_resolution_clock::now();
+    vector<int> secuencia_ils = ILS(secuencia_inicial, tiempos, m, 30);
+    auto fin_ils = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_ils = fin_ils - inicio_ils;
+
+    cout << "Secuencia IterativeLocalSearch: ";
+    for (int t : secuencia_ils) cout << t+1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
+    cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
+}
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, la matriz de ejemplo
+    vector<string> rutas = instance_paths_from_args(argc, argv);
+    if (!rutas.empty()) {
+        vector<FlatInstance> instancias;
+        load_instances(rutas, instancias);
+        for (const auto& instancia : instancias) {
+            cout << "Instancia: " << instancia.name << " (n=" << instancia.n << ", m=" << instancia.m << ")" << endl;
+            ejecutar(instancia.n, instancia.m, instancia.job_rows());
+        }
+        return instancias.empty() ? 1 : 0;
+    }
+
     int n = 100, m = 10;
 
     vector<vector<int>> tiempos = {
@@ -112,38 +163,5 @@ int main() {
     {19,  7, 12, 14,  3, 12, 19, 26,  9, 22, 12, 26,  8, 25,  2, 18,  6, 19, 11, 14},
     { 4, 24, 30,  3,  5, 29, 21,  4,  5,  1, 10, 29,  3, 19, 29,  9, 18,  7,  7, 19}
 };
-        // NEH con medición de tiempo
-    auto inicio_neh = chrono::high_resolution_clock::now();
-    vector<int> secuencia_inicial = neh(n, m, tiempos);
-    auto fin_neh = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_neh = fin_neh - inicio_neh;
-
-    cout << "Secuencia NEH: ";
-    for (int t : secuencia_inicial) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_inicial, tiempos, m) << endl;
-    cout << "Tiempo NEH: " << tiempo_neh.count() << " segundos" << endl;
-    cout << "\n";
-
-    // LS con medición de tiempo
-    auto inicio_ls = chrono::high_resolution_clock::now();
-    vector<int> secuencia_ls = local_search_insertion(secuencia_inicial, tiempos, m);
-    auto fin_ls = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_ls = fin_ls - inicio_ls;
-
-    cout << "Secuencia LocalSearch: ";
-    for (int t : secuencia_ls) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_ls, tiempos, m) << endl;
-    cout << "Tiempo LS: " << tiempo_ls.count() << " segundos" << endl;
-    cout << "\n";
-
-    // ILS con medición de tiempo
-    auto inicio_ils = chrono::high_resolution_clock::now();
-    vector<int> secuencia_ils = ILS(secuencia_inicial, tiempos, m, 30);
-    auto fin_ils = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_ils = fin_ils - inicio_ils;
-
-    cout << "Secuencia IterativeLocalSearch: ";
-    for (int t : secuencia_ils) cout << t+1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_ils, tiempos, m) << endl;
-    cout << "Tiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
-}
\ No newline at end of file
+    ejecutar(n, m, tiempos);
+}
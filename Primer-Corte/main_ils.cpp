@@ -0,0 +1,66 @@
+#include <iostream>
+#include "NEH.h"
+#include "ILS.h"
+#include "../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
+#include <chrono>
+#include <thread>
+
+using namespace std;
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
+
+    // Mismo presupuesto de CPU por instancia: n * (m / 2) * t ms
+    int t = 30;
+
+    for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
+        vector<int> secuencia_inicial = instance.aggregates().neh_sequence();
+
+        ILSParams params;
+        params.tiempo_limite_ms = instance.n * (instance.m / 2.0) * t;
+        params.fuerza = 5;
+        params.max_sin_mejora = 20 * instance.n;
+        params.semilla = static_cast<unsigned int>(instance.seed);
+
+        auto inicio_ils = chrono::high_resolution_clock::now();
+        ILSResult res = ILS_presupuesto(secuencia_inicial, tiempos, instance.m, params);
+        auto fin_ils = chrono::high_resolution_clock::now();
+        chrono::duration<double> tiempo_ils = fin_ils - inicio_ils;
+
+        cout << "Instancia: " << instance.name << " (n=" << instance.n << ", m=" << instance.m << ")" << endl;
+        cout << "Limite: " << params.tiempo_limite_ms << " ms" << endl;
+        cout << "Makespan NEH: " << calcular_makespan(secuencia_inicial, tiempos, instance.m) << endl;
+        cout << "Makespan ILS: " << res.mejor_makespan << endl;
+        cout << "Iteraciones: " << res.iteraciones << ", reinicios: " << res.reinicios
+             << ", evaluaciones completas: " << res.evaluaciones_completas
+             << ", parciales: " << res.evaluaciones << endl;
+        cout << "Traza (ms, evaluaciones parciales, makespan): ";
+        for (const TracePoint& punto : res.traza.points()) {
+            cout << "(" << punto.elapsedNs / 1e6 << ", " << punto.evaluations << ", " << punto.makespan << ") ";
+        }
+        cout << "\nSecuencia ILS: ";
+        for (int x : res.mejor) cout << x+1 << " ";
+        cout << "\nTiempo ILS: " << tiempo_ils.count() << " segundos" << endl;
+
+        // Multi-arranque paralelo con el mismo limite de tiempo
+        params.max_retraso = 5 * instance.n;
+        auto inicio_par = chrono::high_resolution_clock::now();
+        ILSResult res_par = ILS_paralelo(secuencia_inicial, tiempos, instance.m, params);
+        auto fin_par = chrono::high_resolution_clock::now();
+        chrono::duration<double> tiempo_par = fin_par - inicio_par;
+
+        cout << "Makespan ILS paralelo (" << thread::hardware_concurrency() << " hilos): " << res_par.mejor_makespan << endl;
+        cout << "Iteraciones: " << res_par.iteraciones << ", reinicios: " << res_par.reinicios
+             << ", evaluaciones completas: " << res_par.evaluaciones_completas
+             << ", parciales: " << res_par.evaluaciones << endl;
+        cout << "Traza (ms, evaluaciones parciales, makespan): ";
+        for (const TracePoint& punto : res_par.traza.points()) {
+            cout << "(" << punto.elapsedNs / 1e6 << ", " << punto.evaluations << ", " << punto.makespan << ") ";
+        }
+        cout << "\nTiempo ILS paralelo: " << tiempo_par.count() << " segundos" << endl;
+        cout << "----------------------------------------" << endl;
+    }
+}
@@ -0,0 +1,303 @@
+#ifndef BINARY_INSTANCE_H
+#define BINARY_INSTANCE_H
+
+// Formato binario de instancias (.pfsb), para instancias grandes y corridas sobre
+// miles de archivos: el archivo se abre con mmap y los solvers leen los tiempos
+// directamente de las páginas mapeadas, sin parsear texto. Varios procesos que abren
+// el mismo archivo comparten la caché de páginas del sistema.
+//
+// Estructura (enteros en el orden de bytes de la máquina que lo escribió):
+//
+//   [0, 128)            BinaryInstanceHeader
+//   job_major_offset    n x m int32, fila j = tiempos del trabajo j (alineado a 64)
+//   machine_major_offset m x n int32, fila k = tiempos de la máquina k (alineado a 64)
+//
+// Las dos matrices traen los mismos tiempos; cada algoritmo usa la que recorre en orden.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+const char BINARY_INSTANCE_MAGIC[8] = {'P', 'F', 'S', 'P', 'B', 'I', 'N', '1'};
+const uint32_t BINARY_INSTANCE_BYTE_ORDER = 0x01020304;
+const uint64_t BINARY_INSTANCE_ALIGN = 64;
+
+struct BinaryInstanceHeader {
+    char magic[8];
+    uint32_t byte_order;             // BINARY_INSTANCE_BYTE_ORDER tal como quedó en disco
+    uint32_t header_size;
+    int32_t n;
+    int32_t m;
+    int64_t seed;
+    int32_t upper_bound;             // 0 = desconocida
+    int32_t lower_bound;
+    uint64_t job_major_offset;
+    uint64_t machine_major_offset;
+    uint64_t checksum;               // ver binary_header_checksum
+    char name[64];                   // terminado en '\0'
+};
+static_assert(sizeof(BinaryInstanceHeader) == 128, "el encabezado ocupa 128 bytes");
+
+// Bytes que ocupa una matriz de n x m, redondeado a la alineación
+inline uint64_t binary_matrix_bytes(int n, int m) {
+    uint64_t bytes = (uint64_t)n * m * sizeof(int32_t);
+    return (bytes + BINARY_INSTANCE_ALIGN - 1) / BINARY_INSTANCE_ALIGN * BINARY_INSTANCE_ALIGN;
+}
+
+// FNV-1a de 64 bits por palabras de 32 bits. Se acumula en partes para poder
+// calcularlo mientras se escribe.
+const uint64_t BINARY_CHECKSUM_SEED = 1469598103934665603ULL;
+
+inline uint64_t binary_checksum_update(uint64_t h, const int32_t* values, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        h ^= (uint32_t)values[i];
+        h *= 1099511628211ULL;
+    }
+    return h;
+}
+
+// Suma de verificación de un archivo: los campos del encabezado (con checksum = 0)
+// y luego la matriz máquina x trabajo. La matriz trabajo x máquina no entra porque se
+// comprueba contra la otra al abrir con verificación completa.
+inline uint64_t binary_header_checksum(const BinaryInstanceHeader& header) {
+    BinaryInstanceHeader copy = header;
+    copy.checksum = 0;
+    int32_t words[sizeof(copy) / sizeof(int32_t)];
+    std::memcpy(words, &copy, sizeof(copy));
+    return binary_checksum_update(BINARY_CHECKSUM_SEED, words, sizeof(words) / sizeof(int32_t));
+}
+
+inline BinaryInstanceHeader make_binary_header(const std::string& name, int n, int m, long long seed,
+                                               int upper_bound, int lower_bound) {
+    BinaryInstanceHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, BINARY_INSTANCE_MAGIC, sizeof(header.magic));
+    header.byte_order = BINARY_INSTANCE_BYTE_ORDER;
+    header.header_size = sizeof(BinaryInstanceHeader);
+    header.n = n;
+    header.m = m;
+    header.seed = seed;
+    header.upper_bound = upper_bound;
+    header.lower_bound = lower_bound;
+    header.job_major_offset = sizeof(BinaryInstanceHeader);
+    header.machine_major_offset = header.job_major_offset + binary_matrix_bytes(n, m);
+    std::strncpy(header.name, name.c_str(), sizeof(header.name) - 1);
+    return header;
+}
+
+// Archivo .pfsb mapeado en memoria de solo lectura. Se libera al destruir el último
+// shared_ptr que lo referencia.
+class BinaryInstanceMapping {
+public:
+    ~BinaryInstanceMapping() {
+        if (base_) munmap(base_, size_);
+    }
+    BinaryInstanceMapping(const BinaryInstanceMapping&) = delete;
+    BinaryInstanceMapping& operator=(const BinaryInstanceMapping&) = delete;
+
+    const BinaryInstanceHeader& header() const { return *static_cast<const BinaryInstanceHeader*>(base_); }
+    const int* job_major() const { return at(header().job_major_offset); }
+    const int* machine_major() const { return at(header().machine_major_offset); }
+
+    // Mapea y valida el archivo. Con 'verify' se recorre la matriz para comprobar la
+    // suma de verificación y que ambas matrices coincidan; sin ella solo se valida el
+    // encabezado y no se toca ninguna página de datos hasta que un solver la lea.
+    static std::shared_ptr<const BinaryInstanceMapping> open(const std::string& path, std::string& error,
+                                                             bool verify = true) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            error = "no se puede abrir";
+            return nullptr;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(BinaryInstanceHeader)) {
+            ::close(fd);
+            error = "archivo binario truncado";
+            return nullptr;
+        }
+        void* base = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            error = "mmap falló";
+            return nullptr;
+        }
+        std::shared_ptr<BinaryInstanceMapping> mapping(new BinaryInstanceMapping(base, st.st_size));
+        if (!mapping->validate(verify, error)) return nullptr;
+        return mapping;
+    }
+
+private:
+    BinaryInstanceMapping(void* base, size_t size) : base_(base), size_(size) {}
+
+    const int* at(uint64_t offset) const {
+        return reinterpret_cast<const int*>(static_cast<const char*>(base_) + offset);
+    }
+
+    bool validate(bool verify, std::string& error) const {
+        const BinaryInstanceHeader& h = header();
+        if (std::memcmp(h.magic, BINARY_INSTANCE_MAGIC, sizeof(h.magic)) != 0) {
+            error = "no es un archivo de instancia binario";
+            return false;
+        }
+        if (h.byte_order != BINARY_INSTANCE_BYTE_ORDER) {
+            error = "orden de bytes distinto al de esta máquina";
+            return false;
+        }
+        if (h.header_size != sizeof(BinaryInstanceHeader) || h.n <= 0 || h.m <= 0 ||
+            h.name[sizeof(h.name) - 1] != '\0') {
+            error = "encabezado binario inválido";
+            return false;
+        }
+        const uint64_t bytes = binary_matrix_bytes(h.n, h.m);
+        for (uint64_t offset : {h.job_major_offset, h.machine_major_offset}) {
+            if (offset % BINARY_INSTANCE_ALIGN != 0 || offset < sizeof(BinaryInstanceHeader) ||
+                offset > size_ || size_ - offset < bytes) {
+                error = "matriz fuera del archivo o desalineada";
+                return false;
+            }
+        }
+        if (!verify) return true;
+
+        const size_t cells = (size_t)h.n * h.m;
+        uint64_t sum = binary_checksum_update(binary_header_checksum(h), machine_major(), cells);
+        if (sum != h.checksum) {
+            error = "suma de verificación incorrecta";
+            return false;
+        }
+        const int* jobs = job_major();
+        const int* machines = machine_major();
+        for (int j = 0; j < h.n; j++) {
+            for (int k = 0; k < h.m; k++) {
+                if (jobs[(size_t)j * h.m + k] != machines[(size_t)k * h.n + j]) {
+                    error = "las matrices por trabajo y por máquina no coinciden";
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    void* base_;
+    size_t size_;
+};
+
+// Escritura por partes con memoria acotada: primero todas las filas trabajo x máquina,
+// después los tiempos máquina x trabajo en orden, en trozos de cualquier tamaño. La
+// suma de verificación se acumula sobre la marcha y el encabezado se reescribe al
+// final. Se escribe en 'path.tmp' y se renombra en finish(), para que ningún lector
+// mapee un archivo a medias; si no se llega a finish() el temporal se borra.
+class BinaryInstanceWriter {
+public:
+    BinaryInstanceWriter(const std::string& path, const BinaryInstanceHeader& header)
+        : path_(path), tmp_(path + ".tmp"), header_(header),
+          checksum_(binary_header_checksum(header)) {
+        file_ = std::fopen(tmp_.c_str(), "wb");
+        ok_ = file_ && std::fwrite(&header_, sizeof(header_), 1, file_) == 1;
+    }
+    ~BinaryInstanceWriter() {
+        if (file_) {
+            std::fclose(file_);
+            std::remove(tmp_.c_str());
+        }
+    }
+    BinaryInstanceWriter(const BinaryInstanceWriter&) = delete;
+    BinaryInstanceWriter& operator=(const BinaryInstanceWriter&) = delete;
+
+    // 'count' filas de m tiempos, a continuación de las anteriores
+    void write_job_rows(const int32_t* rows, size_t count) {
+        write(rows, count * header_.m);
+        job_cells_ += count * header_.m;
+    }
+
+    void write_machine_values(const int32_t* values, size_t count) {
+        if (machine_cells_ == 0) pad();
+        checksum_ = binary_checksum_update(checksum_, values, count);
+        write(values, count);
+        machine_cells_ += count;
+    }
+
+    bool finish(std::string& error) {
+        if (!file_) {
+            error = "no se puede crear";
+            return false;
+        }
+        const size_t cells = (size_t)header_.n * header_.m;
+        if (job_cells_ != cells || machine_cells_ != cells) ok_ = false;
+        pad();
+        header_.checksum = checksum_;
+        if (ok_) ok_ = std::fseek(file_, 0, SEEK_SET) == 0 && std::fwrite(&header_, sizeof(header_), 1, file_) == 1;
+        ok_ = std::fclose(file_) == 0 && ok_;
+        file_ = nullptr;
+        if (!ok_ || std::rename(tmp_.c_str(), path_.c_str()) != 0) {
+            std::remove(tmp_.c_str());
+            error = "error de escritura";
+            return false;
+        }
+        return true;
+    }
+
+private:
+    void write(const int32_t* values, size_t count) {
+        if (ok_ && count > 0) ok_ = std::fwrite(values, sizeof(int32_t), count, file_) == count;
+    }
+
+    // Relleno hasta la alineación tras cada matriz
+    void pad() {
+        static const char zeros[BINARY_INSTANCE_ALIGN] = {};
+        size_t used = (size_t)header_.n * header_.m * sizeof(int32_t);
+        size_t padding = binary_matrix_bytes(header_.n, header_.m) - used;
+        if (ok_ && padding > 0) ok_ = std::fwrite(zeros, 1, padding, file_) == padding;
+    }
+
+    std::string path_;
+    std::string tmp_;
+    BinaryInstanceHeader header_;
+    uint64_t checksum_;
+    FILE* file_ = nullptr;
+    bool ok_ = false;
+    size_t job_cells_ = 0;
+    size_t machine_cells_ = 0;
+};
+
+// Escribe una instancia a partir de su matriz máquina x trabajo
+inline bool write_binary_instance(const std::string& path, const std::string& name, int n, int m,
+                                  long long seed, int upper_bound, int lower_bound,
+                                  const int* machine_major, std::string& error) {
+    BinaryInstanceWriter writer(path, make_binary_header(name, n, m, seed, upper_bound, lower_bound));
+
+    // Trabajo x máquina, transpuesta por bloques de trabajos
+    std::vector<int32_t> rows;
+    const int block = 256;
+    for (int j0 = 0; j0 < n; j0 += block) {
+        int j1 = std::min(n, j0 + block);
+        rows.resize((size_t)(j1 - j0) * m);
+        for (int k = 0; k < m; k++) {
+            for (int j = j0; j < j1; j++) rows[(size_t)(j - j0) * m + k] = machine_major[(size_t)k * n + j];
+        }
+        writer.write_job_rows(rows.data(), j1 - j0);
+    }
+    writer.write_machine_values(machine_major, (size_t)n * m);
+    return writer.finish(error);
+}
+
+// true si el archivo empieza con la marca del formato binario
+inline bool is_binary_instance_file(const std::string& path) {
+    char magic[sizeof(BINARY_INSTANCE_MAGIC)];
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) return false;
+    bool binary = std::fread(magic, 1, sizeof(magic), file) == sizeof(magic) &&
+                  std::memcmp(magic, BINARY_INSTANCE_MAGIC, sizeof(magic)) == 0;
+    std::fclose(file);
+    return binary;
+}
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef BUDGET_H
+#define BUDGET_H
+
+// Presupuesto de un solver: iteraciones, límite de tiempo y evaluaciones. Cada límite
+// en 0 significa "sin límite"; se agota con el primero de los fijados que se cumpla, y
+// sin ninguno fijado está agotado desde el inicio (un solver sin presupuesto no corre).
+
+#include <chrono>
+
+class SearchBudget {
+public:
+    using clock = std::chrono::steady_clock;
+
+    SearchBudget(long long iterations, double timeLimitMs, long long evaluations = 0,
+                 clock::time_point start = clock::now())
+        : iterations_(iterations), timeLimitMs_(timeLimitMs), evaluations_(evaluations), start_(start) {}
+
+    clock::time_point start() const { return start_; }
+
+    double elapsedMs() const {
+        return std::chrono::duration<double, std::milli>(clock::now() - start_).count();
+    }
+
+    // Solo el límite de tiempo, para los solvers con su propio criterio de iteraciones
+    bool timeUp() const { return timeLimitMs_ > 0.0 && elapsedMs() >= timeLimitMs_; }
+
+    bool exhausted(long long iteration, long long evaluations = 0) const {
+        if (iterations_ > 0 && iteration >= iterations_) return true;
+        if (evaluations_ > 0 && evaluations >= evaluations_) return true;
+        if (timeUp()) return true;
+        return iterations_ <= 0 && evaluations_ <= 0 && timeLimitMs_ <= 0.0;
+    }
+
+private:
+    long long iterations_;
+    double timeLimitMs_;
+    long long evaluations_;
+    clock::time_point start_;
+};
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef CONVERGENCE_TRACE_H
+#define CONVERGENCE_TRACE_H
+
+// Traza "anytime" de un solver: cada vez que mejora su mejor solución guarda el tiempo
+// transcurrido, las evaluaciones hechas hasta ese momento y el nuevo makespan. Con eso
+// se arman curvas de tiempo a calidad (cuánto CPU hace falta para llegar a un RPD).
+//
+// Los puntos van a un buffer circular reservado de antemano: registrar una mejora es
+// una lectura del reloj y una escritura, sin reservar memoria. Si hay más mejoras que
+// capacidad se conservan las últimas, que son las de mejor calidad.
+
+#include <chrono>
+#include <cstddef>
+#include <vector>
+
+struct TracePoint {
+    long long elapsedNs = 0;
+    long long evaluations = 0;
+    int makespan = 0;
+};
+
+class ConvergenceTrace {
+public:
+    using clock = std::chrono::steady_clock;
+    static constexpr size_t kDefaultCapacity = 1024;
+
+    explicit ConvergenceTrace(size_t capacity = kDefaultCapacity) : buffer_(capacity), start_(clock::now()) {}
+
+    // Vacía la traza; los tiempos se miden desde 'start' (el inicio del solver)
+    void restart(clock::time_point start) {
+        start_ = start;
+        next_ = 0;
+        recorded_ = 0;
+    }
+
+    void record(long long evaluations, int makespan) {
+        if (buffer_.empty()) return;
+        TracePoint& point = buffer_[next_];
+        point.elapsedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(clock::now() - start_).count();
+        point.evaluations = evaluations;
+        point.makespan = makespan;
+        next_ = next_ + 1 == buffer_.size() ? 0 : next_ + 1;
+        ++recorded_;
+    }
+
+    size_t capacity() const { return buffer_.size(); }
+    size_t size() const { return recorded_ < buffer_.size() ? recorded_ : buffer_.size(); }
+    bool empty() const { return recorded_ == 0; }
+    // Mejoras que se perdieron por falta de capacidad (las más viejas)
+    size_t dropped() const { return recorded_ - size(); }
+
+    // Los puntos guardados, del más viejo al más nuevo
+    std::vector<TracePoint> points() const {
+        std::vector<TracePoint> out;
+        out.reserve(size());
+        size_t first = recorded_ < buffer_.size() ? 0 : next_;
+        for (size_t i = 0; i < size(); ++i) out.push_back(buffer_[(first + i) % buffer_.size()]);
+        return out;
+    }
+
+private:
+    std::vector<TracePoint> buffer_;
+    clock::time_point start_;
+    size_t next_ = 0;
+    size_t recorded_ = 0;
+};
+
+#endif
@@ -0,0 +1,96 @@
+#ifndef FLAT_INSTANCE_H
+#define FLAT_INSTANCE_H
+
+// Instancia PFSP con los tiempos en un solo arreglo plano, el tipo que comparten el
+// lector de archivos (InstanceLoader.h), el formato binario y el generador de Taillard.
+// Lleva consigo sus agregados (InstanceAggregates.h) para que los solvers no los
+// recalculen.
+
+#include "BinaryInstance.h"
+#include "InstanceAggregates.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+struct FlatInstance {
+    std::string name;
+    int n = 0;
+    int m = 0;
+    long long seed = 0;
+    int upper_bound = 0;             // cotas del encabezado de Taillard (0 = desconocida); la
+                                     // superior es la referencia del RPD en los experimentos
+    int lower_bound = 0;
+    std::vector<int> p;              // m x n, p[k * n + j] = tiempo del trabajo j en la máquina k
+
+    // Instancias binarias: p queda vacío y los tiempos se leen del archivo mapeado,
+    // compartido entre las copias de la instancia
+    std::shared_ptr<const BinaryInstanceMapping> mapping;
+
+    // m x n, fila k = máquina k
+    const int* machine_major() const { return mapping ? mapping->machine_major() : p.data(); }
+    // n x m, fila j = trabajo j; solo existe en instancias binarias (si no, nullptr)
+    const int* job_major() const { return mapping ? mapping->job_major() : nullptr; }
+
+    int time(int machine, int job) const { return machine_major()[(size_t)machine * n + job]; }
+
+    // tiempos[j][k], el formato de NEH y las metaheurísticas
+    std::vector<std::vector<int>> job_rows() const {
+        std::vector<std::vector<int>> rows(n);
+        if (const int* jobs = job_major()) {
+            for (int j = 0; j < n; j++) rows[j].assign(jobs + (size_t)j * m, jobs + (size_t)(j + 1) * m);
+            return rows;
+        }
+        const int* machines = machine_major();
+        for (int j = 0; j < n; j++) rows[j].resize(m);
+        for (int k = 0; k < m; k++) {
+            for (int j = 0; j < n; j++) rows[j][k] = machines[(size_t)k * n + j];
+        }
+        return rows;
+    }
+
+    // processing_times[k][j], el formato del Branch and Bound
+    std::vector<std::vector<int>> machine_rows() const {
+        const int* machines = machine_major();
+        std::vector<std::vector<int>> rows(m);
+        for (int k = 0; k < m; k++) rows[k].assign(machines + (size_t)k * n, machines + (size_t)(k + 1) * n);
+        return rows;
+    }
+
+    // Sumas, cotas triviales, orden y secuencia NEH, órdenes de Johnson
+    // (InstanceAggregates.h). Se calculan la primera vez que se piden, también desde
+    // varios hilos, y leen los tiempos de la propia instancia sin copiarlos. Las copias
+    // de una instancia binaria los comparten; la copia de una en memoria tiene su propio
+    // p, así que calcula los suyos.
+    const InstanceAggregates& aggregates() const {
+        const int* data = job_major() ? job_major() : machine_major();
+        std::shared_ptr<const InstanceAggregates> current = std::atomic_load(&aggregates_);
+        while (!current || current->data() != data) {
+            std::shared_ptr<const InstanceAggregates> built =
+                job_major() ? std::make_shared<const InstanceAggregates>(job_major(), n, m, MatrixLayout::JobMajor)
+                            : std::make_shared<const InstanceAggregates>(machine_major(), n, m, MatrixLayout::MachineMajor);
+            if (std::atomic_compare_exchange_strong(&aggregates_, &current, built)) current = built;
+        }
+        return *current;
+    }
+
+private:
+    mutable std::shared_ptr<const InstanceAggregates> aggregates_;
+};
+
+inline FlatInstance flatten_instance(const std::string& name, int n, int m, long long seed,
+                                     const std::vector<std::vector<int>>& tiempos, int upper_bound = 0) {
+    FlatInstance flat;
+    flat.name = name;
+    flat.n = n;
+    flat.m = m;
+    flat.seed = seed;
+    flat.upper_bound = upper_bound;
+    flat.p.resize((size_t)n * m);
+    for (int j = 0; j < n; j++) {
+        for (int k = 0; k < m; k++) flat.p[k * n + j] = tiempos[j][k];
+    }
+    return flat;
+}
+
+#endif
@@ -1,4 +1,5 @@
 #include "GA.h"
+#include "Budget.h"
 
 #include <algorithm>
 #include <limits>
@@ -7,9 +8,9 @@
 
 using namespace std;
 
-static int calcular_makespan(const vector<int>& secuencia,
-                             const vector<vector<int>>& tiempos,
-                             int m) {
+int compute_makespan_ga(const vector<int>& secuencia,
+                        const vector<vector<int>>& tiempos,
+                        int m) {
     int n = static_cast<int>(secuencia.size());
     if (n == 0) return 0;
 
@@ -26,7 +27,7 @@ static double fitness_from_makespan(int makespan) {
     return 1.0 / (1.0 + static_cast<double>(makespan));
 }
 
-static vector<int> repair_permutation(const vector<int>& individual, int n) {
+vector<int> repair_permutation(const vector<int>& individual, int n) {
     vector<int> repaired = individual;
     vector<int> count(n, 0);
     for (int job : repaired) {
@@ -57,6 +58,19 @@ static vector<int> repair_permutation(const vector<int>& individual, int n) {
     return repaired;
 }
 
+void two_point_crossover(const vector<int>& p1, const vector<int>& p2, int a, int b,
+                         vector<int>& c1, vector<int>& c2) {
+    int n = static_cast<int>(p1.size());
+    c1 = p1;
+    c2 = p2;
+    for (int i = a; i <= b; ++i) {
+        c1[i] = p2[i];
+        c2[i] = p1[i];
+    }
+    c1 = repair_permutation(c1, n);
+    c2 = repair_permutation(c2, n);
+}
+
 static void inversion_mutation(vector<int>& individual, mt19937& rng) {
     int n = static_cast<int>(individual.size());
     if (n < 2) return;
@@ -72,6 +86,8 @@ GAResult run_genetic_algorithm(const vector<vector<int>>& tiempos,
                                int m,
                                const GAParams& params) {
     mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
+
     vector<int> base(n);
     iota(base.begin(), base.end(), 0);
 
@@ -87,32 +103,42 @@ GAResult run_genetic_algorithm(const vector<vector<int>>& tiempos,
     vector<int> makespans(params.populationSize, 0);
 
     GAResult best;
+    best.trace.restart(budget.start());
     best.bestMakespan = numeric_limits<int>::max();
 
     auto evaluate_population = [&]() {
         for (int i = 0; i < params.populationSize; ++i) {
-            makespans[i] = calcular_makespan(population[i], tiempos, m);
+            makespans[i] = compute_makespan_ga(population[i], tiempos, m);
+            best.evaluations++;
             fitness[i] = fitness_from_makespan(makespans[i]);
             if (makespans[i] < best.bestMakespan) {
                 best.bestMakespan = makespans[i];
                 best.bestSequence = population[i];
+                best.trace.record(best.evaluations, best.bestMakespan);
             }
         }
     };
 
-    evaluate_population();
+    {
+        ScopedPhase phase(best.profile, Phase::Initialization, &best.evaluations);
+        evaluate_population();
+    }
 
     uniform_real_distribution<double> prob(0.0, 1.0);
     uniform_int_distribution<int> distIndex(0, n - 1);
 
-    for (int iter = 0; iter < params.iterations; ++iter) {
+    for (int iter = 0; !budget.exhausted(iter); ++iter) {
         vector<double> cumulative(params.populationSize, 0.0);
-        cumulative[0] = fitness[0];
-        for (int i = 1; i < params.populationSize; ++i) {
-            cumulative[i] = cumulative[i - 1] + fitness[i];
+        {
+            ScopedPhase phase(best.profile, Phase::Selection);
+            cumulative[0] = fitness[0];
+            for (int i = 1; i < params.populationSize; ++i) {
+                cumulative[i] = cumulative[i - 1] + fitness[i];
+            }
         }
 
         auto select_parent = [&]() -> const vector<int>& {
+            ScopedPhase phase(best.profile, Phase::Selection);
             uniform_real_distribution<double> dist(0.0, cumulative.back());
             double r = dist(rng);
             auto it = lower_bound(cumulative.begin(), cumulative.end(), r);
@@ -131,23 +157,19 @@ GAResult run_genetic_algorithm(const vector<vector<int>>& tiempos,
             vector<int> c2 = p2;
 
             if (prob(rng) <= params.crossoverProb) {
+                ScopedPhase phase(best.profile, Phase::Recombination);
                 int a = distIndex(rng);
                 int b = distIndex(rng);
                 if (a > b) swap(a, b);
-
-                for (int i = a; i <= b; ++i) {
-                    c1[i] = p2[i];
-                    c2[i] = p1[i];
-                }
-
-                c1 = repair_permutation(c1, n);
-                c2 = repair_permutation(c2, n);
+                two_point_crossover(p1, p2, a, b, c1, c2);
             }
 
             if (prob(rng) <= params.mutationProb) {
+                ScopedPhase phase(best.profile, Phase::Mutation);
                 inversion_mutation(c1, rng);
             }
             if (prob(rng) <= params.mutationProb) {
+                ScopedPhase phase(best.profile, Phase::Mutation);
                 inversion_mutation(c2, rng);
             }
 
@@ -158,6 +180,7 @@ GAResult run_genetic_algorithm(const vector<vector<int>>& tiempos,
         }
 
         population.swap(new_population);
+        ScopedPhase phase(best.profile, Phase::Evaluation, &best.evaluations);
         evaluate_population();
     }
 
@@ -1,6 +1,9 @@
 #ifndef GA_H
 #define GA_H
 
+#include "ConvergenceTrace.h"
+#include "PhaseProfile.h"
+
 #include <vector>
 
 struct GAParams {
@@ -8,12 +11,16 @@ struct GAParams {
     double crossoverProb = 0.80;
     double mutationProb = 0.15;
     int iterations = 0;
+    double timeLimitMs = 0.0;        // 0 = sin limite de tiempo
     unsigned int seed = 0;
 };
 
 struct GAResult {
     std::vector<int> bestSequence;
     int bestMakespan = 0;
+    long long evaluations = 0;       // secuencias completas evaluadas
+    ConvergenceTrace trace;          // (tiempo, evaluaciones, makespan) de cada mejora
+    PhaseProfile profile;            // tiempo y evaluaciones por fase (make PROFILE=1)
 };
 
 GAResult run_genetic_algorithm(const std::vector<std::vector<int>>& tiempos,
@@ -21,4 +28,14 @@ GAResult run_genetic_algorithm(const std::vector<std::vector<int>>& tiempos,
                                int m,
                                const GAParams& params);
 
+// Núcleos del GA, expuestos para los micro-benchmarks (Cuarto-Corte/benchmarks)
+int compute_makespan_ga(const std::vector<int>& secuencia,
+                        const std::vector<std::vector<int>>& tiempos,
+                        int m);
+// Reemplaza los trabajos repetidos o fuera de rango por los que faltan, en orden
+std::vector<int> repair_permutation(const std::vector<int>& individual, int n);
+// Intercambia las posiciones [a, b] de los padres y repara los dos hijos
+void two_point_crossover(const std::vector<int>& p1, const std::vector<int>& p2, int a, int b,
+                         std::vector<int>& c1, std::vector<int>& c2);
+
 #endif
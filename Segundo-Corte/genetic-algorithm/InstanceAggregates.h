@@ -0,0 +1,232 @@
+#ifndef INSTANCE_AGGREGATES_H
+#define INSTANCE_AGGREGATES_H
+
+// Datos derivados de una instancia que varios algoritmos usaban recalculándolos en
+// cada llamada (sumas por trabajo en NEH y ACO, trabajo por máquina en el B&B, órdenes
+// de Johnson, la propia secuencia NEH en cada reinicio de PR-RG). Se calculan una vez
+// por instancia y se guardan junto a ella (FlatInstance::aggregates); los solvers los
+// reciben por sus parámetros y, si no vienen, los calculan para esa llamada.
+//
+// Las sumas y cotas se calculan al construir, en O(n*m). La secuencia NEH (O(n^2*m))
+// y los órdenes de Johnson de cada par se calculan la primera vez que se piden.
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+enum class MatrixLayout {
+    JobMajor,        // p[j * m + k], como tiempos[j][k]
+    MachineMajor     // p[k * n + j], como processing_times[k][j]
+};
+
+class InstanceAggregates {
+public:
+    int n = 0;
+    int m = 0;
+
+    std::vector<int> job_total;          // suma de tiempos de cada trabajo
+    std::vector<int> machine_total;      // suma de tiempos de cada máquina
+    long long total_work = 0;            // suma de todos los tiempos
+
+    // Mínimo sobre los trabajos del tiempo antes de llegar a la máquina k (cabeza) y
+    // después de dejarla (cola): ninguna máquina empieza antes de min_head[k] ni
+    // termina su último trabajo a menos de min_tail[k] del final.
+    std::vector<int> min_head;
+    std::vector<int> min_tail;
+
+    // Orden de prioridad de NEH: suma de tiempos decreciente, empates por índice mayor
+    std::vector<int> neh_order;
+
+    // Cotas inferiores triviales del makespan
+    int job_bound = 0;                   // el trabajo más largo
+    int machine_bound = 0;               // max_k min_head[k] + machine_total[k] + min_tail[k]
+    int lower_bound = 0;                 // la mayor de las dos
+
+    // Sin copiar la matriz: 'p' (la de FlatInstance o el .pfsb mapeado) debe vivir
+    // mientras se usen estos agregados
+    InstanceAggregates(const int* p, int n_jobs, int n_machines, MatrixLayout layout)
+        : n(n_jobs), m(n_machines), times_(p),
+          job_stride_(layout == MatrixLayout::JobMajor ? n_machines : 1),
+          machine_stride_(layout == MatrixLayout::JobMajor ? 1 : n_jobs) {
+        build();
+    }
+
+    // tiempos[j][k]: las filas se copian a una matriz propia trabajo x máquina
+    InstanceAggregates(const std::vector<std::vector<int>>& tiempos, int n_jobs, int n_machines)
+        : n(n_jobs), m(n_machines), owned_((size_t)n_jobs * n_machines), times_(owned_.data()),
+          job_stride_(n_machines), machine_stride_(1) {
+        for (int j = 0; j < n; j++) std::copy(tiempos[j].begin(), tiempos[j].begin() + m, &owned_[(size_t)j * m]);
+        build();
+    }
+
+    InstanceAggregates(const InstanceAggregates&) = delete;
+    InstanceAggregates& operator=(const InstanceAggregates&) = delete;
+
+    int time(int job, int machine) const {
+        return times_[(size_t)job * job_stride_ + (size_t)machine * machine_stride_];
+    }
+
+    // La matriz de la que se calcularon
+    const int* data() const { return times_; }
+
+    // Tiempo de un trabajo en las máquinas estrictamente entre k y l
+    int lag(int k, int l, int job) const {
+        int sum = 0;
+        for (int i = k + 1; i < l; i++) sum += time(job, i);
+        return sum;
+    }
+
+    // Secuencia NEH (inserción acelerada de Taillard sobre neh_order, la primera mejor
+    // posición en cada paso) y su makespan
+    const std::vector<int>& neh_sequence() const {
+        std::call_once(neh_once_, [this] { build_neh(); });
+        return neh_sequence_;
+    }
+    int neh_makespan() const {
+        neh_sequence();
+        return neh_makespan_;
+    }
+
+    // Orden de Johnson-Mitten del par (k, l), k < l, con retardos lag(k, l, j):
+    // primero los trabajos con a_j <= b_j por a_j creciente, después el resto por b_j
+    // decreciente, con a_j = p[j][k] + lag_j y b_j = p[j][l] + lag_j. Empates por índice.
+    const std::vector<int>& johnson_order(int k, int l) const {
+        std::lock_guard<std::mutex> lock(johnson_mutex_);
+        if (johnson_.empty()) johnson_.resize((size_t)m * m);
+        std::vector<int>& order = johnson_[(size_t)k * m + l];
+        if (order.empty() && n > 0) order = build_johnson(k, l);
+        return order;
+    }
+
+private:
+    std::vector<int> owned_;             // solo al construir desde filas
+    const int* times_;
+    size_t job_stride_;
+    size_t machine_stride_;
+
+    mutable std::once_flag neh_once_;
+    mutable std::vector<int> neh_sequence_;
+    mutable int neh_makespan_ = 0;
+
+    mutable std::mutex johnson_mutex_;
+    mutable std::vector<std::vector<int>> johnson_;   // m x m, vacío hasta pedirlo
+
+    void build() {
+        job_total.assign(n, 0);
+        machine_total.assign(m, 0);
+        min_head.assign(m, 0);
+        min_tail.assign(m, 0);
+        for (int j = 0; j < n; j++) {
+            for (int k = 0; k < m; k++) {
+                job_total[j] += time(j, k);
+                machine_total[k] += time(j, k);
+            }
+            total_work += job_total[j];
+            job_bound = std::max(job_bound, job_total[j]);
+        }
+
+        for (int j = 0; j < n; j++) {
+            int head = 0;
+            for (int k = 0; k < m; k++) {
+                int tail = job_total[j] - head - time(j, k);
+                if (j == 0 || head < min_head[k]) min_head[k] = head;
+                if (j == 0 || tail < min_tail[k]) min_tail[k] = tail;
+                head += time(j, k);
+            }
+        }
+        for (int k = 0; k < m; k++) {
+            machine_bound = std::max(machine_bound, min_head[k] + machine_total[k] + min_tail[k]);
+        }
+        lower_bound = std::max(job_bound, machine_bound);
+
+        neh_order.resize(n);
+        for (int j = 0; j < n; j++) neh_order[j] = j;
+        std::sort(neh_order.begin(), neh_order.end(), [&](int a, int b) {
+            return job_total[a] != job_total[b] ? job_total[a] > job_total[b] : a > b;
+        });
+    }
+
+    void build_neh() const {
+        const int w = m + 2;
+        std::vector<int>& seq = neh_sequence_;
+        seq.clear();
+        seq.reserve(n);
+        std::vector<int> e((size_t)(n + 2) * w, 0), q((size_t)(n + 2) * w, 0);
+
+        for (int job : neh_order) {
+            // Cabezas e (prefijos) y colas q (sufijos) de la secuencia parcial, con
+            // bordes en cero; cada posición se evalúa en O(m)
+            const int k = seq.size();
+            for (int i = 1; i <= k; i++) {
+                for (int c = 1; c <= m; c++) {
+                    e[i * w + c] = std::max(e[(i - 1) * w + c], e[i * w + c - 1]) + time(seq[i - 1], c - 1);
+                }
+            }
+            for (int c = 1; c <= m; c++) q[(k + 1) * w + c] = 0;
+            for (int i = k; i >= 1; i--) {
+                for (int c = m; c >= 1; c--) {
+                    q[i * w + c] = std::max(q[(i + 1) * w + c], q[i * w + c + 1]) + time(seq[i - 1], c - 1);
+                }
+            }
+
+            int best_pos = 0;
+            int best = 0;
+            for (int pos = 0; pos <= k; pos++) {
+                int f = 0;
+                int ms = 0;
+                for (int c = 1; c <= m; c++) {
+                    f = std::max(f, e[pos * w + c]) + time(job, c - 1);
+                    ms = std::max(ms, f + q[(pos + 1) * w + c]);
+                }
+                if (pos == 0 || ms < best) {
+                    best = ms;
+                    best_pos = pos;
+                }
+            }
+            seq.insert(seq.begin() + best_pos, job);
+            neh_makespan_ = best;
+        }
+    }
+
+    std::vector<int> build_johnson(int k, int l) const {
+        std::vector<int> lag(n), first, second;
+        for (int j = 0; j < n; j++) {
+            lag[j] = this->lag(k, l, j);
+            if (time(j, k) <= time(j, l)) first.push_back(j);
+            else second.push_back(j);
+        }
+        std::sort(first.begin(), first.end(), [&](int x, int y) {
+            int ax = time(x, k) + lag[x], ay = time(y, k) + lag[y];
+            return ax != ay ? ax < ay : x < y;
+        });
+        std::sort(second.begin(), second.end(), [&](int x, int y) {
+            int bx = time(x, l) + lag[x], by = time(y, l) + lag[y];
+            return bx != by ? bx > by : x < y;
+        });
+        first.insert(first.end(), second.begin(), second.end());
+        return first;
+    }
+};
+
+// Los agregados recibidos por parámetro o, si no hay, unos calculados para esta
+// llamada y guardados en 'local'. Se ignoran si no son de una instancia de n x m.
+inline const InstanceAggregates& aggregates_or_build(const InstanceAggregates* given,
+                                                     std::unique_ptr<InstanceAggregates>& local,
+                                                     const std::vector<std::vector<int>>& tiempos,
+                                                     int n, int m) {
+    if (given && given->n == n && given->m == m) return *given;
+    local.reset(new InstanceAggregates(tiempos, n, m));
+    return *local;
+}
+
+// Lo mismo a partir de una matriz plana (p. ej. la de un .pfsb mapeado), sin armar filas
+inline const InstanceAggregates& aggregates_or_build(const InstanceAggregates* given,
+                                                     std::unique_ptr<InstanceAggregates>& local,
+                                                     const int* p, int n, int m, MatrixLayout layout) {
+    if (given && given->n == n && given->m == m) return *given;
+    local.reset(new InstanceAggregates(p, n, m, layout));
+    return *local;
+}
+
+#endif
@@ -0,0 +1,305 @@
+#ifndef INSTANCE_LOADER_H
+#define INSTANCE_LOADER_H
+
+// Lectura de instancias desde archivos de texto, para no recompilar al cambiar de
+// instancias. Formatos aceptados (se detectan solos, un archivo puede traer varias):
+//
+//   Taillard: encabezado de texto, una línea "n m semilla cota_superior cota_inferior",
+//   "processing times :" y m filas de n tiempos (máquina x trabajo).
+//
+//   OR-Library (flowshop1.txt): "n m" y n filas con m pares "máquina tiempo". Las
+//   líneas de texto como "instance car1" dan el nombre.
+//
+//   Simple: "n m" y la matriz, m filas de n (máquina x trabajo) o n filas de m
+//   (trabajo x máquina); si n == m se toma máquina x trabajo.
+//
+//   Binario (.pfsb, ver BinaryInstance.h): se reconoce por la marca inicial y se
+//   mapea en memoria en lugar de leerse. Solo se validan el encabezado, el tamaño y la
+//   alineación, sin tocar las páginas de datos; la suma de verificación se comprueba
+//   con 'verify' (pfsp_instances --verify).
+//
+//   En lugar de una ruta se puede dar el nombre de una instancia de Taillard (ta001,
+//   o un rango ta001-ta010), que se genera sin leer ningún archivo.
+//
+// Los tiempos quedan en un solo arreglo plano (o en el archivo mapeado); cada
+// algoritmo arma sus filas (job_rows / machine_rows) solo para la instancia que está
+// resolviendo.
+
+#include "FlatInstance.h"
+#include "Instances.h"
+#include "TaillardInstances.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace instance_loader_detail {
+
+// Líneas del archivo formadas solo por enteros. Los números de todas ellas quedan en
+// 'values'; line_start[i] es el índice del primero de la línea i. Para cada línea se
+// guarda también el nombre de la última línea "instance ..." vista (OR-Library).
+struct NumericLines {
+    std::vector<long long> values;
+    std::vector<size_t> line_start;
+    std::vector<std::string> label;
+
+    size_t lines() const { return line_start.size(); }
+    size_t count(size_t line) const {
+        size_t end = line + 1 < line_start.size() ? line_start[line + 1] : values.size();
+        return end - line_start[line];
+    }
+};
+
+inline void scan_lines(const std::string& text, NumericLines& out) {
+    std::string label;
+    const char* s = text.data();
+    const char* end = s + text.size();
+    while (s < end) {
+        const char* eol = s;
+        while (eol < end && *eol != '\n') eol++;
+
+        // Intentar leer la línea como enteros; si aparece otra cosa, es texto
+        size_t mark = out.values.size();
+        bool numeric = true;
+        bool any = false;
+        for (const char* c = s; c < eol;) {
+            if (*c == ' ' || *c == '\t' || *c == '\r' || *c == ',') {
+                c++;
+                continue;
+            }
+            bool negative = *c == '-';
+            if (negative || *c == '+') c++;
+            if (c >= eol || *c < '0' || *c > '9') {
+                numeric = false;
+                break;
+            }
+            long long v = 0;
+            while (c < eol && *c >= '0' && *c <= '9') v = v * 10 + (*c++ - '0');
+            if (c < eol && *c != ' ' && *c != '\t' && *c != '\r' && *c != ',') {
+                numeric = false;
+                break;
+            }
+            out.values.push_back(negative ? -v : v);
+            any = true;
+        }
+        if (numeric && any) {
+            out.line_start.push_back(mark);
+            out.label.push_back(label);
+        } else {
+            out.values.resize(mark);
+            if (!numeric) {
+                // "instance car1" -> "car1"
+                std::string line(s, eol);
+                while (!line.empty() && (line.back() == '\r' || line.back() == ' ')) line.pop_back();
+                size_t first = line.find_first_not_of(" \t");
+                line = first == std::string::npos ? "" : line.substr(first);
+                if (line.rfind("instance ", 0) == 0) label = line.substr(9);
+            }
+        }
+        s = eol + 1;
+    }
+}
+
+}  // namespace instance_loader_detail
+
+// Lee todas las instancias de un archivo y las agrega a 'out'. Devuelve false con el
+// motivo en 'error' si el archivo no se puede leer o no tiene un formato reconocido.
+inline bool load_instance_file(const std::string& path, std::vector<FlatInstance>& out, std::string& error,
+                               bool verify = false) {
+    using namespace instance_loader_detail;
+
+    if (is_binary_instance_file(path)) {
+        FlatInstance inst;
+        inst.mapping = BinaryInstanceMapping::open(path, error, verify);
+        if (!inst.mapping) return false;
+        const BinaryInstanceHeader& header = inst.mapping->header();
+        inst.name = header.name[0] ? header.name : std::filesystem::path(path).stem().string();
+        inst.n = header.n;
+        inst.m = header.m;
+        inst.seed = header.seed;
+        inst.upper_bound = header.upper_bound;
+        inst.lower_bound = header.lower_bound;
+        out.push_back(std::move(inst));
+        return true;
+    }
+
+    std::string text;
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file) {
+        error = "no se puede abrir";
+        return false;
+    }
+    std::fseek(file, 0, SEEK_END);
+    long size = std::ftell(file);
+    std::fseek(file, 0, SEEK_SET);
+    text.resize(size > 0 ? size : 0);
+    size_t read = size > 0 ? std::fread(&text[0], 1, size, file) : 0;
+    std::fclose(file);
+    if ((long)read != size) {
+        error = "error de lectura";
+        return false;
+    }
+
+    NumericLines lines;
+    scan_lines(text, lines);
+
+    std::string stem = std::filesystem::path(path).stem().string();
+    size_t first_new = out.size();
+    size_t line = 0;
+    while (line < lines.lines()) {
+        const long long* header = &lines.values[lines.line_start[line]];
+        size_t header_count = lines.count(line);
+        if (header_count != 2 && header_count != 3 && header_count != 5) {
+            error = "se esperaba un encabezado 'n m' y se encontró una línea de " +
+                    std::to_string(header_count) + " números";
+            return false;
+        }
+
+        FlatInstance inst;
+        inst.n = (int)header[0];
+        inst.m = (int)header[1];
+        if (header_count >= 3) inst.seed = header[2];
+        if (header_count == 5) {
+            inst.upper_bound = (int)header[3];
+            inst.lower_bound = (int)header[4];
+        }
+        if (inst.n <= 0 || inst.m <= 0) {
+            error = "dimensiones inválidas";
+            return false;
+        }
+        inst.name = lines.label[line];
+        const size_t cells = (size_t)inst.n * inst.m;
+        line++;
+
+        // Los datos empiezan en la siguiente línea numérica y pueden ocupar varias
+        size_t begin = line < lines.lines() ? lines.line_start[line] : lines.values.size();
+        size_t first_row = line < lines.lines() ? lines.count(line) : 0;
+        bool pairs = header_count == 2 && first_row == 2 * (size_t)inst.m;
+        for (int k = 0; pairs && k < inst.m; k++) {
+            pairs = lines.values[begin + 2 * k] == k;   // OR-Library: máquinas 0..m-1 en orden
+        }
+        bool job_major = header_count == 2 && !pairs && first_row == (size_t)inst.m && inst.m != inst.n;
+        size_t needed = pairs ? 2 * cells : cells;
+        if (lines.values.size() - begin < needed) {
+            error = "faltan tiempos de proceso en la instancia " + std::to_string(out.size() - first_new + 1);
+            return false;
+        }
+
+        inst.p.resize(cells);
+        const long long* v = &lines.values[begin];
+        for (size_t i = 0; i < cells; i++) {
+            long long machine, time;
+            int job;
+            if (pairs) {
+                job = i / inst.m;
+                machine = v[2 * i];
+                time = v[2 * i + 1];
+                if (machine < 0 || machine >= inst.m) {
+                    error = "índice de máquina fuera de rango";
+                    return false;
+                }
+            } else if (job_major) {
+                job = i / inst.m;
+                machine = i % inst.m;
+                time = v[i];
+            } else {
+                job = i % inst.n;
+                machine = i / inst.n;
+                time = v[i];
+            }
+            if (time < 0) {
+                error = "tiempo de proceso negativo";
+                return false;
+            }
+            inst.p[machine * inst.n + job] = (int)time;
+        }
+
+        // Avanzar hasta la primera línea que no se consumió
+        size_t consumed = begin + needed;
+        while (line < lines.lines() && lines.line_start[line] < consumed) line++;
+        out.push_back(std::move(inst));
+    }
+
+    if (out.size() == first_new) {
+        error = "no contiene instancias";
+        return false;
+    }
+    // Sin "instance ..." el nombre sale del archivo (tai20_5_1, tai20_5_2, ...)
+    size_t count = out.size() - first_new;
+    for (size_t i = first_new; i < out.size(); i++) {
+        std::string& name = out[i].name;
+        if (name.empty()) {
+            name = count == 1 ? stem : stem + "_" + std::to_string(i - first_new + 1);
+        }
+    }
+    return true;
+}
+
+// Guarda una instancia en el formato binario
+inline bool save_binary_instance(const std::string& path, const FlatInstance& inst, std::string& error) {
+    return write_binary_instance(path, inst.name, inst.n, inst.m, inst.seed, inst.upper_bound,
+                                 inst.lower_bound, inst.machine_major(), error);
+}
+
+// Carga archivos y directorios (estos recursivamente, en orden alfabético). Un nombre
+// del benchmark de Taillard ("ta001", "ta001-ta010") que no sea un archivo existente se
+// genera en memoria (TaillardInstances.h). Los errores se informan por cerr con la ruta
+// y la carga sigue; devuelve false si hubo alguno.
+inline bool load_instances(const std::vector<std::string>& paths, std::vector<FlatInstance>& out,
+                           bool verify = false) {
+    namespace fs = std::filesystem;
+    bool ok = true;
+    for (const std::string& path : paths) {
+        std::vector<std::string> files;
+        std::error_code ec;
+        if (!fs::exists(path, ec) && taillard_instances_by_name(path, out)) continue;
+        if (fs::is_directory(path, ec)) {
+            for (const auto& entry : fs::recursive_directory_iterator(path, ec)) {
+                if (!entry.is_regular_file()) continue;
+                std::string file_name = entry.path().filename().string();
+                if (!file_name.empty() && file_name[0] != '.') files.push_back(entry.path().string());
+            }
+            std::sort(files.begin(), files.end());
+        } else {
+            files.push_back(path);
+        }
+        for (const std::string& file : files) {
+            std::string error;
+            if (!load_instance_file(file, out, error, verify)) {
+                std::cerr << file << ": " << error << std::endl;
+                ok = false;
+            }
+        }
+    }
+    return ok;
+}
+
+// Rutas de instancias en la línea de comandos: todo argumento que no empiece con '-'
+inline std::vector<std::string> instance_paths_from_args(int argc, char** argv) {
+    std::vector<std::string> paths;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') paths.push_back(argv[i]);
+    }
+    return paths;
+}
+
+// Instancias de los archivos y directorios dados, o las de Instances.h si no se dio
+// ninguno. Las rutas que fallan se informan y se saltan; devuelve false solo si no
+// quedó ninguna instancia.
+inline bool instances_from_args(int argc, char** argv, std::vector<FlatInstance>& out) {
+    std::vector<std::string> paths = instance_paths_from_args(argc, argv);
+    if (!paths.empty()) {
+        load_instances(paths, out);
+        return !out.empty();
+    }
+    for (const Instance& instance : get_taillard_benchmark_instances()) {
+        out.push_back(flatten_instance(instance.name, instance.n, instance.m, instance.seed, instance.tiempos,
+                                       instance.upper_bound));
+    }
+    return true;
+}
+
+#endif
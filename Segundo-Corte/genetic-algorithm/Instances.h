@@ -10,6 +10,7 @@ struct Instance {
     int n;
     int m;
     long long seed;
+    int upper_bound;                 // makespan de referencia para el RPD (0 = desconocido)
     vector<vector<int>> tiempos;
 };
 
@@ -22,6 +23,7 @@ inline vector<Instance> get_taillard_benchmark_instances() {
         20,
         5,
         873654221,
+        1278,
         {
             {54, 79, 16, 66, 58},
             {83,  3, 89, 58, 56},
@@ -51,6 +53,7 @@ inline vector<Instance> get_taillard_benchmark_instances() {
         20,
         10,
         587595453,
+        1582,
         {
             {74, 28, 89, 60, 54, 92,  9,  4, 25, 15},
             {21,  3, 52, 88, 66, 11,  8, 18, 15, 84},
@@ -80,6 +83,7 @@ inline vector<Instance> get_taillard_benchmark_instances() {
         50,
         10,
         1958948863,
+        3037,
         {
             {46, 61,  3, 51, 37, 79, 83, 22, 27, 24},
             {52, 87,  1, 24, 16, 93, 87, 29, 92, 47},
@@ -139,6 +143,7 @@ inline vector<Instance> get_taillard_benchmark_instances() {
         100,
         10,
         960914243,
+        5776,
         {
             {47, 94, 56, 59, 74, 78, 17, 74, 12, 98},
             {12, 93, 31, 94, 26, 58, 60, 71,  5, 97},
@@ -248,6 +253,7 @@ inline vector<Instance> get_taillard_benchmark_instances() {
         100,
         20,
         450926852,
+        6330,
         {
             {12, 27, 24, 42,  5, 27, 51, 48, 42, 31, 48, 51,  8,  1,  1, 28,  4, 44,  6, 57},
             {72, 97, 57, 16, 42, 69,  9, 44, 18, 49, 92, 84, 37, 77, 59, 81, 40,  6, 49, 88},
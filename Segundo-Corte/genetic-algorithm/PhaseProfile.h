@@ -0,0 +1,175 @@
+#ifndef PHASE_PROFILE_H
+#define PHASE_PROFILE_H
+
+// Perfil por fases de un solver: tiempo (ciclos del TSC), veces que se entró a la fase,
+// evaluaciones completas (makespan desde cero), evaluaciones parciales (una posición
+// de inserción con cabezas y colas de Taillard) y vecinos examinados.
+//
+// Solo mide si se compila con -DPFSP_PROFILE (make PROFILE=1). Sin esa bandera
+// ScopedPhase y los contadores son funciones vacías que el compilador elimina, y el
+// perfil del resultado queda en cero.
+//
+// Uso: un ScopedPhase por bloque. Al salir suma los ciclos a su fase y, si se le dio el
+// contador de evaluaciones del solver, las evaluaciones completas hechas dentro del
+// bloque. Los vecinos y las evaluaciones parciales se cuentan con count_neighbours y
+// count_partial (y las completas con count_full si el solver no lleva un contador
+// aparte), que van a la fase del ScopedPhase más interno. Los bloques no se
+// anidan: el externo contaría también el tiempo y las evaluaciones del interno.
+
+#include <chrono>
+
+#ifdef PFSP_PROFILE
+#include <thread>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+#endif
+
+enum class Phase {
+    Initialization = 0,
+    Selection,
+    Recombination,
+    Mutation,
+    Construction,
+    LocalSearch,
+    PathRelinking,
+    Restart,
+    PheromoneUpdate,
+    Evaluation
+};
+const int NUM_PHASES = 10;
+
+inline const char* phase_name(Phase phase) {
+    static const char* const names[NUM_PHASES] = {
+        "initialization", "selection", "recombination", "mutation", "construction",
+        "local_search", "path_relinking", "restart", "pheromone_update", "evaluation"
+    };
+    return names[static_cast<int>(phase)];
+}
+
+struct PhaseStats {
+    unsigned long long ticks = 0;
+    long long calls = 0;
+    long long fullEvaluations = 0;
+    long long partialEvaluations = 0;
+    long long neighbours = 0;
+};
+
+// Ciclos del TSC (o nanosegundos del reloj monotónico fuera de x86)
+inline unsigned long long read_ticks() {
+#if defined(PFSP_PROFILE) && (defined(__x86_64__) || defined(__i386__))
+    return __rdtsc();
+#else
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+// Ciclos por segundo, calibrados contra el reloj monotónico la primera vez que se piden
+inline double ticks_per_second() {
+#if defined(PFSP_PROFILE) && (defined(__x86_64__) || defined(__i386__))
+    static const double rate = [] {
+        auto t0 = std::chrono::steady_clock::now();
+        unsigned long long c0 = read_ticks();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        unsigned long long c1 = read_ticks();
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+        return (c1 - c0) / elapsed.count();
+    }();
+    return rate;
+#else
+    return 1e9;
+#endif
+}
+
+class PhaseProfile {
+public:
+    PhaseStats phases[NUM_PHASES];
+
+    static constexpr bool enabled() {
+#ifdef PFSP_PROFILE
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    const PhaseStats& operator[](Phase phase) const { return phases[static_cast<int>(phase)]; }
+    double seconds(Phase phase) const { return (*this)[phase].ticks / ticks_per_second(); }
+
+    // Suma el perfil de otro hilo del mismo solver; los segundos quedan en tiempo de
+    // CPU de todos los hilos, no en tiempo de pared
+    void merge(const PhaseProfile& other) {
+        for (int i = 0; i < NUM_PHASES; ++i) {
+            phases[i].ticks += other.phases[i].ticks;
+            phases[i].calls += other.phases[i].calls;
+            phases[i].fullEvaluations += other.phases[i].fullEvaluations;
+            phases[i].partialEvaluations += other.phases[i].partialEvaluations;
+            phases[i].neighbours += other.phases[i].neighbours;
+        }
+    }
+
+    void count_neighbours(long long count = 1) {
+#ifdef PFSP_PROFILE
+        if (current_ >= 0) phases[current_].neighbours += count;
+#else
+        (void)count;
+#endif
+    }
+
+    void count_full(long long count) {
+#ifdef PFSP_PROFILE
+        if (current_ >= 0) phases[current_].fullEvaluations += count;
+#else
+        (void)count;
+#endif
+    }
+
+    void count_partial(long long count) {
+#ifdef PFSP_PROFILE
+        if (current_ >= 0) phases[current_].partialEvaluations += count;
+#else
+        (void)count;
+#endif
+    }
+
+private:
+    friend class ScopedPhase;
+    int current_ = -1;
+};
+
+class ScopedPhase {
+public:
+#ifdef PFSP_PROFILE
+    ScopedPhase(PhaseProfile& profile, Phase phase, const long long* evaluations = nullptr)
+        : profile_(profile), phase_(static_cast<int>(phase)), outer_(profile.current_),
+          evaluations_(evaluations), startEvaluations_(evaluations ? *evaluations : 0), start_(read_ticks()) {
+        profile_.current_ = phase_;
+        profile_.phases[phase_].calls++;
+    }
+
+    ~ScopedPhase() {
+        PhaseStats& stats = profile_.phases[phase_];
+        stats.ticks += read_ticks() - start_;
+        if (evaluations_) stats.fullEvaluations += *evaluations_ - startEvaluations_;
+        profile_.current_ = outer_;
+    }
+#else
+    ScopedPhase(PhaseProfile&, Phase, const long long* = nullptr) {}
+#endif
+
+    ScopedPhase(const ScopedPhase&) = delete;
+    ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+#ifdef PFSP_PROFILE
+private:
+    PhaseProfile& profile_;
+    int phase_;
+    int outer_;
+    const long long* evaluations_;
+    long long startEvaluations_;
+    unsigned long long start_;
+#endif
+};
+
+#endif
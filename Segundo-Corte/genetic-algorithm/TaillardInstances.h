@@ -0,0 +1,266 @@
+#ifndef TAILLARD_INSTANCES_H
+#define TAILLARD_INSTANCES_H
+
+// Generador de Taillard (1993) en memoria: cualquier instancia se regenera desde
+// (n, m, semilla) sin archivos ni recompilar, y las 120 del benchmark se piden por
+// nombre (ta001 ... ta120), con su cota superior publicada. Los tiempos salen en el
+// mismo orden que en el artículo, máquina por máquina, que es justo el orden
+// máquina x trabajo de FlatInstance.
+
+#include "FlatInstance.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+class TaillardRNG {
+private:
+    static const long long a = 16807;
+    static const long long m = 2147483647;
+    static const long long b = 127773;
+    static const long long c = 2836;
+    long long seed;
+
+public:
+    TaillardRNG(long long s) : seed(s) {}
+
+    double nextDouble() {
+        long long k = seed / b;
+        seed = a * (seed % b) - k * c;
+        if (seed < 0)
+            seed += m;
+        return (double)seed / m;
+    }
+
+    int nextInt(int low, int high) {
+        return low + (int)(nextDouble() * (high - low + 1));
+    }
+
+    // Avanza 'count' pasos de una vez (seed * a^count mod m), para generar cualquier
+    // tramo del flujo sin recorrer los anteriores
+    void skip(long long count) {
+        long long factor = 1;
+        long long base = a;
+        for (; count > 0; count >>= 1) {
+            if (count & 1) factor = factor * base % m;
+            base = base * base % m;
+        }
+        seed = seed * factor % m;
+    }
+};
+
+struct TaillardSpec {
+    int n;
+    int m;
+    long long seed;
+};
+
+const int TAILLARD_COUNT = 120;
+
+// Semillas del artículo, 10 por tamaño y en el orden de ta001 a ta120
+const long long TAILLARD_SEEDS[TAILLARD_COUNT] = {
+    // 20 x 5
+    873654221, 379008056, 1866992158, 216771124, 495070989,
+    402959317, 1369363414, 2021925980, 573109518, 88325120,
+    // 20 x 10
+    587595453, 1401007982, 873136276, 268827376, 1634173168,
+    691823909, 73807235, 1273398721, 2065119309, 1672900551,
+    // 20 x 20
+    479340445, 268827376, 1958948863, 918272953, 555010963,
+    2010851491, 1519833303, 1748670931, 1923497586, 1829909967,
+    // 50 x 5
+    1328042058, 200382020, 496319842, 1203030903, 1730708564,
+    450926852, 1303135678, 1273398721, 587288402, 248421594,
+    // 50 x 10
+    1958948863, 575633267, 655816003, 1977864101, 93805469,
+    1803345551, 49612559, 1899802599, 2013025619, 578962478,
+    // 50 x 20
+    1539989115, 691823909, 655816003, 1315102446, 1949668355,
+    1923497586, 1805594913, 1861070898, 715643788, 464843328,
+    // 100 x 5
+    896678084, 1179439976, 1122278347, 416756875, 267829958,
+    1835213917, 1328833962, 1418570761, 161033112, 304212574,
+    // 100 x 10
+    1539989115, 655816003, 960914243, 1915696806, 2013025619,
+    1168140026, 1923497586, 167698528, 1528387973, 993794175,
+    // 100 x 20
+    450926852, 1462772409, 1021685265, 83696007, 508154254,
+    1861070898, 26482542, 444956424, 2115448041, 118254244,
+    // 200 x 10
+    471503978, 1215892992, 135346136, 1602504050, 160037322,
+    551454346, 519485142, 383947510, 1968171878, 540872513,
+    // 200 x 20
+    2013025619, 475051709, 914834335, 810642687, 1019331795,
+    2056065863, 1342855162, 1325809384, 1988803007, 765656702,
+    // 500 x 20
+    1368624604, 450181436, 1927888393, 1759567256, 606425239,
+    19268348, 1298201670, 2041736264, 379756761, 28837162,
+};
+
+// Cotas superiores publicadas por Taillard (mejores makespans conocidos), en el
+// mismo orden que las semillas; son la referencia del RPD de las 120 instancias
+const int TAILLARD_UPPER_BOUNDS[TAILLARD_COUNT] = {
+    // 20 x 5
+    1278, 1359, 1081, 1293, 1235, 1195, 1234, 1206, 1230, 1108,
+    // 20 x 10
+    1582, 1659, 1496, 1377, 1419, 1397, 1484, 1538, 1593, 1591,
+    // 20 x 20
+    2297, 2099, 2326, 2223, 2291, 2226, 2273, 2200, 2237, 2178,
+    // 50 x 5
+    2724, 2834, 2621, 2751, 2863, 2829, 2725, 2683, 2552, 2782,
+    // 50 x 10
+    2991, 2867, 2839, 3063, 2976, 3006, 3093, 3037, 2897, 3065,
+    // 50 x 20
+    3850, 3704, 3640, 3723, 3611, 3681, 3704, 3691, 3743, 3756,
+    // 100 x 5
+    5493, 5268, 5175, 5014, 5250, 5135, 5246, 5094, 5448, 5322,
+    // 100 x 10
+    5770, 5349, 5676, 5781, 5467, 5303, 5595, 5617, 5871, 5845,
+    // 100 x 20
+    6202, 6183, 6271, 6269, 6314, 6364, 6268, 6401, 6275, 6434,
+    // 200 x 10
+    10862, 10480, 10922, 10889, 10524, 10329, 10854, 10730, 10438, 10675,
+    // 200 x 20
+    11195, 11203, 11281, 11275, 11259, 11176, 11360, 11334, 11192, 11288,
+    // 500 x 20
+    26059, 26520, 26371, 26456, 26334, 26477, 26389, 26560, 26005, 26457,
+};
+
+// index en 1..120
+inline TaillardSpec taillard_spec(int index) {
+    static const int sizes[TAILLARD_COUNT / 10][2] = {
+        {20, 5}, {20, 10}, {20, 20}, {50, 5}, {50, 10}, {50, 20},
+        {100, 5}, {100, 10}, {100, 20}, {200, 10}, {200, 20}, {500, 20},
+    };
+    const int* size = sizes[(index - 1) / 10];
+    return {size[0], size[1], TAILLARD_SEEDS[index - 1]};
+}
+
+inline std::string taillard_name(int index) {
+    char name[8];
+    std::snprintf(name, sizeof(name), "ta%03d", index);
+    return name;
+}
+
+// "ta001" -> 1; 0 si el nombre no es de la forma taNNN con NNN en 1..120
+inline int taillard_index(const std::string& name) {
+    if (name.size() != 5 || name[0] != 't' || name[1] != 'a') return 0;
+    int index = 0;
+    for (size_t i = 2; i < name.size(); i++) {
+        if (name[i] < '0' || name[i] > '9') return 0;
+        index = index * 10 + (name[i] - '0');
+    }
+    return index >= 1 && index <= TAILLARD_COUNT ? index : 0;
+}
+
+// Índice 1..120 de (n, m, seed) en el benchmark; 0 si no es una de sus instancias
+inline int taillard_index(int n, int m, long long seed) {
+    for (int index = 1; index <= TAILLARD_COUNT; index++) {
+        TaillardSpec spec = taillard_spec(index);
+        if (spec.n == n && spec.m == m && spec.seed == seed) return index;
+    }
+    return 0;
+}
+
+// Cota superior publicada de (n, m, seed); 0 (desconocida) fuera del benchmark
+inline int taillard_upper_bound(int n, int m, long long seed) {
+    int index = taillard_index(n, m, seed);
+    return index > 0 ? TAILLARD_UPPER_BOUNDS[index - 1] : 0;
+}
+
+// taNNN si (n, m, seed) es del benchmark, o tai_<n>x<m>_<semilla> si no
+inline std::string taillard_default_name(int n, int m, long long seed) {
+    int index = taillard_index(n, m, seed);
+    if (index > 0) return taillard_name(index);
+    return "tai_" + std::to_string(n) + "x" + std::to_string(m) + "_" + std::to_string(seed);
+}
+
+// Genera la instancia sin pasar por la caché; las del benchmark traen su cota superior
+inline FlatInstance generate_taillard_instance(int n, int m, long long seed, std::string name = "") {
+    if (name.empty()) name = taillard_default_name(n, m, seed);
+
+    FlatInstance inst;
+    inst.name = name;
+    inst.n = n;
+    inst.m = m;
+    inst.seed = seed;
+    inst.upper_bound = taillard_upper_bound(n, m, seed);
+    inst.p.resize((size_t)n * m);
+    TaillardRNG rng(seed);
+    for (int& time : inst.p) time = rng.nextInt(1, 99);
+    return inst;
+}
+
+// Instancia de la caché del proceso, generada la primera vez que se pide. Es segura
+// entre hilos; la referencia vale mientras dure el programa.
+inline const FlatInstance& taillard_instance(int n, int m, long long seed) {
+    static std::mutex mutex;
+    static std::map<std::tuple<int, int, long long>, FlatInstance> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto key = std::make_tuple(n, m, seed);
+    auto it = cache.find(key);
+    if (it == cache.end()) it = cache.emplace(key, generate_taillard_instance(n, m, seed)).first;
+    return it->second;
+}
+
+inline const FlatInstance& taillard_instance(int index) {
+    TaillardSpec spec = taillard_spec(index);
+    return taillard_instance(spec.n, spec.m, spec.seed);
+}
+
+// Genera la instancia directo al formato binario, sin tenerla entera en memoria: se
+// usan a lo sumo 'chunk_cells' tiempos a la vez. El archivo es idéntico al que
+// escribe save_binary_instance con generate_taillard_instance.
+//   - máquina x trabajo: el flujo del generador en su orden, por trozos
+//   - trabajo x máquina: por bloques de trabajos; para cada máquina se salta con
+//     TaillardRNG::skip al primer trabajo del bloque en esa fila
+inline bool write_taillard_binary(const std::string& path, int n, int m, long long seed, std::string& error,
+                                  std::string name = "", size_t chunk_cells = 1 << 20) {
+    if (n <= 0 || m <= 0) {
+        error = "dimensiones inválidas";
+        return false;
+    }
+    if (name.empty()) name = taillard_default_name(n, m, seed);
+    BinaryInstanceWriter writer(path, make_binary_header(name, n, m, seed, taillard_upper_bound(n, m, seed), 0));
+
+    const int block = (int)std::max<size_t>(1, std::min<size_t>(n, chunk_cells / m));
+    std::vector<int32_t> buffer((size_t)block * m);
+    for (int j0 = 0; j0 < n; j0 += block) {
+        int j1 = std::min(n, j0 + block);
+        for (int k = 0; k < m; k++) {
+            TaillardRNG rng(seed);
+            rng.skip((long long)k * n + j0);
+            for (int j = j0; j < j1; j++) buffer[(size_t)(j - j0) * m + k] = rng.nextInt(1, 99);
+        }
+        writer.write_job_rows(buffer.data(), j1 - j0);
+    }
+
+    TaillardRNG rng(seed);
+    const size_t cells = (size_t)n * m;
+    buffer.resize(std::max<size_t>(1, std::min(chunk_cells, cells)));
+    for (size_t done = 0; done < cells;) {
+        size_t count = std::min(buffer.size(), cells - done);
+        for (size_t i = 0; i < count; i++) buffer[i] = rng.nextInt(1, 99);
+        writer.write_machine_values(buffer.data(), count);
+        done += count;
+    }
+    return writer.finish(error);
+}
+
+// Agrega las instancias de "ta001" o de un rango "ta001-ta010". Devuelve false si
+// el texto no nombra instancias del benchmark.
+inline bool taillard_instances_by_name(const std::string& text, std::vector<FlatInstance>& out) {
+    size_t dash = text.find('-');
+    int first = taillard_index(text.substr(0, dash));
+    int last = dash == std::string::npos ? first : taillard_index(text.substr(dash + 1));
+    if (first == 0 || last < first) return false;
+    for (int index = first; index <= last; index++) out.push_back(taillard_instance(index));
+    return true;
+}
+
+#endif
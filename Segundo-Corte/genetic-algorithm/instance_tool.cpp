@@ -0,0 +1,100 @@
+#include "InstanceLoader.h"
+
+#include <cstdio>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// Convierte instancias (cualquier formato que lea InstanceLoader.h) al formato
+// binario mapeable, una instancia por archivo: DIR/<nombre>.pfsb. Con --generate se
+// escriben instancias de Taillard de cualquier tamaño por trozos, sin tenerlas en
+// memoria, para las pruebas de escalabilidad. Con --verify solo se leen las instancias
+// comprobando la suma de verificación de los .pfsb (los solvers no la comprueban).
+static void usage(const char* prog) {
+    cerr << "Uso: " << prog << " [--out=DIR] [--generate=NxM:SEMILLA]... [--chunk=CELDAS] [--verify] [INSTANCIAS...]" << endl;
+    cerr << "  INSTANCIAS: archivos, directorios o nombres ta001..ta120 a convertir" << endl;
+    cerr << "  --generate: instancia de Taillard de n trabajos y m máquinas (p. ej. 100000x200:12345)" << endl;
+    cerr << "  --chunk:    tiempos por trozo al generar (por defecto 1048576)" << endl;
+    cerr << "  --verify:   comprobar las instancias (suma de verificación de los .pfsb) sin convertir" << endl;
+}
+
+struct GenerateSpec {
+    int n;
+    int m;
+    long long seed;
+};
+
+int main(int argc, char** argv) {
+    string out_dir = ".";
+    size_t chunk_cells = 1 << 20;
+    bool verify = false;
+    vector<string> paths;
+    vector<GenerateSpec> generate;
+    for (int i = 1; i < argc; i++) {
+        string arg = argv[i];
+        GenerateSpec spec;
+        if (arg.rfind("--out=", 0) == 0) {
+            out_dir = arg.substr(6);
+        } else if (arg == "--verify") {
+            verify = true;
+        } else if (arg.rfind("--chunk=", 0) == 0 && stoll(arg.substr(8)) > 0) {
+            chunk_cells = stoll(arg.substr(8));
+        } else if (arg.rfind("--generate=", 0) == 0 &&
+                   sscanf(arg.c_str() + 11, "%dx%d:%lld", &spec.n, &spec.m, &spec.seed) == 3 &&
+                   spec.n > 0 && spec.m > 0) {
+            generate.push_back(spec);
+        } else if (arg[0] != '-') {
+            paths.push_back(arg);
+        } else {
+            usage(argv[0]);
+            return 1;
+        }
+    }
+    if (paths.empty() && generate.empty()) {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (verify) {
+        vector<FlatInstance> instances;
+        bool ok = load_instances(paths, instances, true);
+        for (const FlatInstance& instance : instances) {
+            cout << instance.name << " (n=" << instance.n << ", m=" << instance.m << "): correcta" << endl;
+        }
+        return ok ? 0 : 1;
+    }
+
+    error_code ec;
+    filesystem::create_directories(out_dir, ec);
+    auto output_path = [&](const string& name) {
+        return (filesystem::path(out_dir) / (name + ".pfsb")).string();
+    };
+
+    vector<FlatInstance> instances;
+    bool ok = load_instances(paths, instances);
+    for (const FlatInstance& instance : instances) {
+        string path = output_path(instance.name);
+        string error;
+        if (!save_binary_instance(path, instance, error)) {
+            cerr << path << ": " << error << endl;
+            ok = false;
+            continue;
+        }
+        cout << path << " (n=" << instance.n << ", m=" << instance.m << ")" << endl;
+    }
+
+    for (const GenerateSpec& spec : generate) {
+        string path = output_path(taillard_default_name(spec.n, spec.m, spec.seed));
+        string error;
+        if (!write_taillard_binary(path, spec.n, spec.m, spec.seed, error, "", chunk_cells)) {
+            cerr << path << ": " << error << endl;
+            ok = false;
+            continue;
+        }
+        cout << path << " (n=" << spec.n << ", m=" << spec.m << ", semilla=" << spec.seed << ")" << endl;
+    }
+    return ok ? 0 : 1;
+}
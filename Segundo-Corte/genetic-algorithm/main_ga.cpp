@@ -1,15 +1,18 @@
 #include "GA.h"
-#include "Instances.h"
+#include "InstanceLoader.h"
 
 #include <chrono>
 #include <iostream>
 
 using namespace std;
 
-int main() {
-    auto instances = get_taillard_benchmark_instances();
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
 
     for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
         GAParams params;
         params.populationSize = 150;
         params.crossoverProb = 0.85;
@@ -18,7 +21,7 @@ int main() {
         params.seed = static_cast<unsigned int>(chrono::high_resolution_clock::now().time_since_epoch().count());
 
         auto start = chrono::high_resolution_clock::now();
-        GAResult result = run_genetic_algorithm(instance.tiempos, instance.n, instance.m, params);
+        GAResult result = run_genetic_algorithm(tiempos, instance.n, instance.m, params);
         auto end = chrono::high_resolution_clock::now();
         chrono::duration<double> elapsed = end - start;
 
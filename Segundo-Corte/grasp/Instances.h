@@ -1,358 +0,0 @@
-#ifndef INSTANCES_H
-#define INSTANCES_H
-
-#include <string>
-#include <vector>
-using namespace std;
-
-struct Instance {
-    string name;
-    int n;
-    int m;
-    long long seed;
-    vector<vector<int>> tiempos;
-};
-
-inline vector<Instance> get_taillard_benchmark_instances() {
-    vector<Instance> instances;
-    instances.reserve(5);
-
-    instances.push_back({
-        "pfsp_20x5",
-        20,
-        5,
-        873654221,
-        {
-            {54, 79, 16, 66, 58},
-            {83,  3, 89, 58, 56},
-            {15, 11, 49, 31, 20},
-            {71, 99, 15, 68, 85},
-            {77, 56, 89, 78, 53},
-            {36, 70, 45, 91, 35},
-            {53, 99, 60, 13, 53},
-            {38, 60, 23, 59, 41},
-            {27,  5, 57, 49, 69},
-            {87, 56, 64, 85, 13},
-            {76,  3,  7, 85, 86},
-            {91, 61,  1,  9, 72},
-            {14, 73, 63, 39,  8},
-            {29, 75, 41, 41, 49},
-            {12, 47, 63, 56, 47},
-            {77, 14, 47, 40, 87},
-            {32, 21, 26, 54, 58},
-            {87, 86, 75, 77, 18},
-            {68,  5, 77, 51, 68},
-            {94, 77, 40, 31, 28}
-        }
-    });
-
-    instances.push_back({
-        "pfsp_20x10",
-        20,
-        10,
-        587595453,
-        {
-            {74, 28, 89, 60, 54, 92,  9,  4, 25, 15},
-            {21,  3, 52, 88, 66, 11,  8, 18, 15, 84},
-            {58, 27, 56, 26, 12, 54, 88, 25, 91,  8},
-            { 4, 61, 13, 58, 57, 97, 72, 28, 49, 30},
-            {21, 34,  7, 76, 70, 57, 27, 95, 56, 95},
-            {28, 76, 32, 98, 82, 53, 22, 51, 10, 79},
-            {58, 64, 32, 29, 99, 65, 50, 84, 62,  9},
-            {83, 87, 98, 47, 84, 77,  2, 18, 70, 91},
-            {31, 54, 46, 79, 16, 51, 49,  6, 76, 76},
-            {61, 98, 60, 26, 41, 36, 82, 90, 99, 26},
-            {94, 76, 23, 19, 23, 53, 93, 69, 58, 42},
-            {44, 41, 87, 48, 11, 19, 96, 61, 83, 66},
-            {97, 70,  7, 95, 68, 54, 43, 57, 84, 70},
-            {94, 43, 36, 78, 58, 86, 13,  5, 64, 91},
-            {66, 42, 26, 77, 30, 40, 60, 75, 74, 67},
-            { 6, 79, 85, 90,  5, 56, 11,  4, 14,  3},
-            {37, 88,  7, 24,  5, 79, 37, 38, 18, 98},
-            {22, 15, 34, 10, 39, 74, 91, 28, 48,  4},
-            {99, 49, 36, 85, 58, 24, 84,  4, 96, 71},
-            {83, 72, 48, 55, 31,  3, 67, 80, 86, 62}
-        }
-    });
-
-    instances.push_back({
-        "pfsp_50x10",
-        50,
-        10,
-        1958948863,
-        {
-            {46, 61,  3, 51, 37, 79, 83, 22, 27, 24},
-            {52, 87,  1, 24, 16, 93, 87, 29, 92, 47},
-            {79, 51, 58, 21, 42, 68, 38, 99, 75, 39},
-            {45, 25, 85, 57, 47, 75, 38, 25, 94, 66},
-            {97, 73, 33, 69, 94, 37, 86, 98, 18, 41},
-            {10, 93, 71, 51, 14, 44, 67, 55, 41, 46},
-            {44, 28, 58, 50, 94, 34, 23, 80, 37, 24},
-            {24, 90, 56, 51, 34, 39, 19, 82, 58, 23},
-            {85, 94, 64, 21, 72, 76, 97, 33, 56, 68},
-            {75, 59, 43, 19, 36, 62, 78, 68, 20, 50},
-            {66, 64, 48, 63, 88, 74, 66, 47,  2, 93},
-            {49,  2, 69, 91, 51, 28, 67, 74, 39, 22},
-            {95, 16, 96, 11, 41, 78,  7, 26, 91, 64},
-            {61, 35, 35,  6, 71, 43, 23, 61, 81, 81},
-            {19, 53, 82, 31, 94, 98, 67, 95, 33, 94},
-            {47, 40, 53, 63, 99, 83,  8, 55, 14, 97},
-            {84, 81, 64, 36, 11, 91, 77, 11, 88, 54},
-            {13, 26, 11, 39, 97, 27, 71, 42, 22, 82},
-            {11, 85, 61, 57, 44,  6, 85, 72, 36, 11},
-            {19,  4, 36, 47, 77, 82, 29, 14, 65, 91},
-            {98,  4, 53, 56, 69, 60, 49,  8, 79, 23},
-            { 2, 10, 87, 65, 91, 44,  3, 98, 23, 32},
-            {85, 63, 88, 59, 38, 43, 94, 90, 66, 26},
-            {44, 96, 10,  4, 25, 76, 76, 36,  5, 22},
-            { 7, 55, 32, 10, 87, 99, 95, 75, 15, 12},
-            {73, 71, 38, 12,  7, 66, 48, 69, 51, 23},
-            {19, 66, 25, 62, 66, 11,  4, 26,  2, 34},
-            {69, 94, 24, 43, 54, 35, 37, 24, 81, 87},
-            {12,  7, 90, 49, 86, 52, 82, 55, 12, 59},
-            {73, 15,  7, 54, 49,  8, 57, 98, 40,  2},
-            {85, 11, 11, 87,  3, 40, 61, 86, 59, 38},
-            {23, 99, 49, 29, 48, 62,  6, 30, 32, 84},
-            {53, 37,  2,  2, 44, 25, 97, 92, 16, 62},
-            {16, 50, 76, 18, 93, 24,  5, 94, 87, 10},
-            {88, 56, 17, 75, 37, 30, 27, 66, 78, 11},
-            { 8, 69, 32, 39, 82,  1, 95, 47, 41, 93},
-            {26, 22, 39, 77, 31, 73, 46,  3, 43, 57},
-            {42, 56,  9, 69, 59, 27, 92, 41, 94, 81},
-            {58, 67, 83, 15, 78, 16, 46, 41,  1, 10},
-            {63, 63, 69, 78, 33, 91, 52, 47, 93, 40},
-            { 7, 96, 67, 68, 36, 33,  8, 89, 22, 62},
-            { 2, 74, 28, 37,  3, 11, 11, 28, 93, 49},
-            {44,  4, 88, 22, 58, 99,  7, 39, 62, 90},
-            {38, 42, 23, 41, 10,  2, 54, 80, 53, 34},
-            {24, 40, 91, 92, 98, 60, 72, 47, 30, 11},
-            {76, 30, 71, 67,  6, 90, 57, 57, 34, 81},
-            {85, 93,  3, 24, 44, 36, 85, 74, 27, 51},
-            {61, 36, 26, 87, 62, 62, 22, 38, 30, 21},
-            {32, 25, 41, 91, 24, 15, 87, 59, 54, 39},
-            {90, 87, 96, 31, 94,  3, 65,  5, 77, 27}
-        }
-    });
-
-    instances.push_back({
-        "pfsp_100x10",
-        100,
-        10,
-        960914243,
-        {
-            {47, 94, 56, 59, 74, 78, 17, 74, 12, 98},
-            {12, 93, 31, 94, 26, 58, 60, 71,  5, 97},
-            {19, 53, 66, 87, 84, 53, 51, 89, 15, 69},
-            {32, 63, 73, 22, 41, 17, 61, 81, 16, 24},
-            {63, 41, 96, 59,  3, 36, 26, 59, 64, 10},
-            {78, 81, 31, 30, 46,  3, 60, 62,  6,  7},
-            {77, 74, 41,  2, 39, 83, 80, 64, 65, 79},
-            {51, 37, 79, 55, 90, 91, 45, 62, 53, 84},
-            {59, 52, 66, 36, 62, 73, 20, 67, 19, 50},
-            {54, 24, 49, 73, 63, 81, 62, 68, 93, 86},
-            {48, 45, 39, 98, 74, 74, 55, 87, 21, 24},
-            {96, 19, 28, 15,  4,  2, 25, 47, 38, 28},
-            {52, 72, 24, 54, 37, 31, 68, 60, 54, 73},
-            {42, 62, 85, 55, 75, 37, 56, 10, 46, 72},
-            {57, 78, 64,  3, 72, 78,  5, 76, 33, 19},
-            {30, 83, 37, 54, 30, 74, 14, 46, 38, 20},
-            {34, 98, 85, 89, 43, 51, 20, 56, 32,  8},
-            {77, 83, 40, 50, 95, 41, 19, 48, 12, 20},
-            {80, 58, 35, 68, 41, 78, 92, 61, 90, 45},
-            { 7, 61, 77,  9, 97, 26, 88, 13, 46, 59},
-            {11, 47, 30, 81, 70, 33, 23, 13,  8, 51},
-            { 2, 16, 26, 42, 92, 70, 78, 38, 78, 54},
-            {91, 28, 41, 11, 36, 10, 35, 37, 95, 58},
-            {99, 48,  6, 12, 70, 45, 94, 11, 28, 16},
-            { 5, 63, 19, 55, 37, 70, 31, 12, 47, 38},
-            {43, 74, 83, 75, 36,  2, 67, 63, 10, 94},
-            {39, 45, 52, 10, 42, 92, 10, 97, 16, 72},
-            {64, 36, 54, 91, 34, 50, 15, 26, 45, 69},
-            { 8, 29, 71, 87, 29, 54, 32, 27, 18, 14},
-            {26, 38, 86,  5, 80, 64, 94, 89,  4, 83},
-            {71, 66, 45, 44, 91, 44, 15, 74, 98, 86},
-            {32, 62, 78, 56, 56,  4, 53, 80, 35, 58},
-            {73, 96, 61, 18, 71, 99, 42, 83, 85, 61},
-            {26, 22,  5, 89, 14, 43, 45, 49, 77, 77},
-            {91, 95, 87, 51, 31, 43, 39, 79,  4, 63},
-            {92, 81, 43, 94, 75, 11, 84, 49, 33, 67},
-            {55, 92, 44, 11, 80, 60, 64, 44, 87,  1},
-            {51, 20, 42, 56, 73, 53, 27, 30, 47, 59},
-            {11, 51, 30, 37, 32, 45, 10, 30,  5, 18},
-            {22, 71, 12, 85, 56, 63, 22, 53, 81, 26},
-            {75, 30,  7, 55, 84, 87, 14, 46, 25, 45},
-            {49, 23, 18, 33, 20, 20,  8, 26, 31, 82},
-            {95, 77, 80,  9, 64, 71, 70, 31, 83, 78},
-            {88, 20, 53, 20, 44, 95, 91,  1, 45, 43},
-            { 6,  1,  6, 26, 69, 71, 23, 43, 23, 61},
-            {19, 96, 81, 80, 63, 99, 35, 27, 30,  2},
-            {99, 32, 29, 98, 94, 79,  6, 91, 89, 70},
-            {73, 13, 22, 88, 86, 19, 52, 70, 40, 52},
-            {27,  8, 49, 55, 66, 41, 93, 89, 92, 99},
-            {50, 36,  1, 78, 97, 74, 26, 68, 48, 60},
-            {25, 18, 79, 53, 25,  8, 89,  2, 63, 97},
-            {33, 64, 56, 46, 90, 55, 49, 82, 63,  1},
-            {94, 58, 15,  3, 12, 87, 89, 72, 76, 76},
-            {35,  1, 36, 56, 62, 87, 60, 29, 90,  8},
-            {63, 72, 48, 46, 83, 37,  6, 12,  1, 15},
-            {44, 10, 31, 34, 32, 52, 60, 37, 24, 69},
-            {80, 20, 57, 27, 12, 36, 24, 46,  1,  5},
-            { 7,  6, 49, 21, 38,  6, 70, 50, 77, 31},
-            {72, 40, 20, 81, 22, 42, 42, 93, 91, 39},
-            {95, 91, 67, 14, 92, 30, 86, 77, 78, 34},
-            {40, 56, 20, 52, 63,  3, 64,  6, 93,  9},
-            {48, 39, 34, 50, 61, 86, 47, 77, 32, 81},
-            {41, 68, 78, 80, 46,  3, 19,  7, 97, 34},
-            {15, 50, 27, 48,  6, 89, 17, 63, 85, 16},
-            {18, 93, 40, 22, 83, 57, 30, 21, 91, 14},
-            {31, 71, 46, 10, 49, 27, 79, 85, 40, 13},
-            {68, 79, 23, 56, 78, 28, 53, 67, 67, 36},
-            {99, 57, 28, 18, 84, 88, 71, 77, 84, 73},
-            {79,  5, 84, 67, 97, 48, 77, 95, 31,  6},
-            {78, 95, 33, 63, 56, 26, 95, 52,  5, 43},
-            {95, 41, 87, 47, 76, 58, 73, 97, 89, 29},
-            {37, 12, 76, 43,  9,  6, 97, 79, 59, 68},
-            {37, 84, 18, 71, 38, 33, 32, 21, 69, 59},
-            {50, 81,  3,  4, 21,  3, 25, 20, 68, 76},
-            {79, 88, 77, 29, 80, 25, 85,  7, 46, 86},
-            {30, 32, 50, 99, 47, 61, 79, 54,  4, 43},
-            { 2, 94, 96,  6, 24, 93, 17, 71, 90, 12},
-            {30, 37, 75, 19, 95, 69, 31, 79, 76, 18},
-            {78, 31, 91, 56, 80, 53, 78, 22, 97, 55},
-            {99, 25, 12, 96, 65, 47, 31, 77, 33, 21},
-            {42, 92, 34, 44, 72, 28, 21, 59, 23,  9},
-            {99, 74, 51, 94, 91, 36,  5, 11, 46, 47},
-            {16, 49, 54, 83, 21, 39, 34, 69, 36, 17},
-            {58, 10, 37, 30, 70, 63, 96, 85, 70, 49},
-            {35, 76, 82, 65, 12, 66, 95,  7, 98, 28},
-            {84, 11, 69, 61, 67, 44, 63, 85, 45, 12},
-            {84, 44, 49, 21, 65, 18,  4, 42, 49, 84},
-            {35, 32, 19, 76, 90, 67, 60, 44, 50, 12},
-            {20, 89, 69,  8, 47, 17, 35, 74, 52, 62},
-            { 4, 56, 48, 99, 82, 84,  6, 69, 67, 15},
-            { 9, 69, 96, 68, 62,  9, 75, 68,  6,  7},
-            {44, 76, 13, 42,  3, 33, 41, 64, 58, 26},
-            {35, 65,  4, 38, 84, 80, 61, 37, 71, 58},
-            { 5, 47, 28, 44, 30, 27, 11,  4, 53, 30},
-            {68, 53, 74,  7, 91, 42, 74, 89, 36,  5},
-            {43, 39,  7,  3,  5, 60, 52, 96, 80,  7},
-            {69, 41, 24, 61, 11, 96, 60, 92,  8, 40},
-            { 9, 89, 98, 10, 41, 81, 43, 74, 27, 50},
-            {78, 39, 30, 84, 14, 31, 50, 33, 21, 30},
-            {57, 20, 97, 78, 28, 88, 66, 90, 66, 64}
-        }
-    });
-
-    instances.push_back({
-        "pfsp_100x20",
-        100,
-        20,
-        450926852,
-        {
-            {12, 27, 24, 42,  5, 27, 51, 48, 42, 31, 48, 51,  8,  1,  1, 28,  4, 44,  6, 57},
-            {72, 97, 57, 16, 42, 69,  9, 44, 18, 49, 92, 84, 37, 77, 59, 81, 40,  6, 49, 88},
-            {29, 53, 68, 44, 47, 38, 22, 73, 31, 78, 43, 28, 33, 92, 53, 96,  5, 18, 84, 88},
-            {16, 16, 58, 75, 47, 66, 15, 95, 18, 23, 35, 63,  4, 57, 22, 99, 37, 51, 72, 43},
-            {22, 36, 76, 32, 47, 21, 84, 72, 55, 37,  7, 86,  8, 46, 10, 79, 80, 77, 39, 25},
-            {61, 28, 70, 66, 78, 65, 38, 12, 82, 34, 51, 99, 38, 75, 48, 97, 46, 47, 51, 81},
-            {69, 50, 72, 31, 94,  3, 71, 30, 64, 43, 85, 27, 97,  2, 94, 15, 14, 27, 77,  3},
-            {71, 41, 56,  6, 18,  7, 11, 22, 36,  7, 66, 24, 75, 14, 46,  6, 81, 17, 59,  3},
-            {86, 42, 56,  6, 14, 10, 45, 25, 48, 69, 87, 36, 76, 14, 57, 77, 16, 42, 97, 78},
-            {16, 86, 55, 52, 97, 11, 48, 92, 74, 97, 71, 83, 93, 79, 55, 98, 10, 84,  5, 97},
-            {54,  2, 89,  7, 54, 41, 29,  5, 17, 15, 16, 24, 69, 64, 66,  5, 79,  3, 83, 74},
-            {53, 45, 23, 92, 73, 64, 31, 44, 60, 38, 40, 54, 10,  8, 69, 51, 35, 69, 51, 71},
-            {64, 86, 42, 45, 94,  9, 14, 90, 18, 80, 22, 34, 25, 73,  7, 51, 41,  3,  9, 50},
-            {96, 43, 26, 70, 17, 15, 56, 35, 88, 78, 12, 49, 40, 15, 13, 60, 83,  6,  9, 70},
-            {79, 92, 87, 72, 97, 71, 59, 24, 37, 89,  2, 43, 88, 71, 64, 17, 13, 94, 59, 23},
-            {68, 73, 17, 48,  7, 86, 35, 64, 29, 95, 90,  5, 90,  6, 83, 98, 93, 58, 30, 43},
-            {98, 99, 38, 86, 94,  2,  7, 82, 19,  1, 63, 70, 57, 54, 39, 46, 55, 65, 86, 51},
-            {87, 84, 24, 63, 94, 26, 20,  7, 51, 18, 52, 56, 39, 59, 46, 87, 48, 36, 49, 97},
-            {40, 83, 82, 61, 68, 57, 48, 34, 20, 11, 15, 71, 29, 49, 59, 44, 35, 28, 46, 57},
-            {74, 61, 55, 92,  4, 78, 88, 91,  7, 11,  6, 12, 97, 38, 36, 18, 75, 68, 13, 77},
-            {22,  7, 47, 73, 60, 84, 54, 59, 43, 92, 18, 30, 51, 21, 69, 71, 66, 73, 45, 90},
-            {23,  8,  7, 49, 70, 20, 30,  5, 77, 99, 87, 77, 97, 60, 47, 93, 82, 81, 51, 58},
-            {47, 62, 99, 53, 68, 21, 81, 47, 95, 81, 66, 55,  5,  8, 83, 97,  3, 12, 68, 75},
-            {55,  3, 89, 20, 22,  3,  2, 96, 92, 79,  7, 92, 75, 35, 25, 44, 79, 89, 82,  4},
-            {21, 21, 20, 97, 17, 39,  1,  7, 27, 53, 43, 78, 91, 81, 12, 18, 78, 53,  6, 12},
-            {90, 50, 65, 58, 59, 64, 78, 53, 70, 47, 27, 79, 80, 96, 28, 59, 48, 14, 99,  2},
-            {68, 71,  3, 59, 98, 51,  8, 60, 91, 48, 78, 52, 81, 61, 30,  9, 99, 88, 12,  4},
-            {14, 95, 45, 29, 55, 83,  8, 77, 74, 32, 80, 19, 60, 89, 49, 45, 91, 78,  8, 28},
-            {42, 70, 89, 98, 76, 12, 71, 61, 62, 58, 73, 16, 97, 58, 81, 78, 29, 63, 36, 54},
-            {41, 60, 96, 61,  3, 16, 60, 14, 80, 33, 86, 21, 14, 32, 56, 67, 87, 81, 24, 39},
-            {40,  4, 16, 83, 21,  3, 41, 88, 85, 65, 82, 37,  2, 59, 96, 65, 27, 29, 82, 30},
-            {63, 58, 42,  8, 10,  1, 39, 97,  8, 86, 33, 85, 55, 89, 89, 50,  2, 15, 73, 71},
-            {23, 16, 70, 83, 11, 88,  8, 92, 39, 60, 92, 56, 97, 99, 73, 87, 48, 81, 66, 89},
-            {75, 30, 69, 73, 44, 80, 96, 65, 85, 47,  8, 29, 60,  7, 52, 29, 33, 84, 69, 33},
-            { 4, 80, 77,  2, 29, 77,  3, 73, 83, 89, 87, 56,  8, 79, 12, 80, 92, 36, 71, 85},
-            {31, 71, 46, 56, 43,  2, 79, 19, 76, 40, 64, 23, 30, 38, 98, 14, 15,  8, 70,  2},
-            {87, 59, 20,  7, 60, 14, 48, 99, 31, 72,  7, 19, 87,  1, 12, 70, 55, 60, 61, 69},
-            {25, 75, 71, 15, 14, 60, 23, 92, 12, 54, 26, 52, 42, 67, 40, 10, 24, 24, 42, 20},
-            {47, 52, 91, 55, 46, 45, 38, 19, 69, 29, 79, 39, 16, 63, 70, 30, 59, 57, 77, 64},
-            {70, 25,  8,  3,  3, 39, 85, 66, 26, 57, 49,  4, 56, 42, 35, 19, 41, 87, 10, 94},
-            { 1, 86, 34, 73, 60, 32, 32, 25, 54, 93, 71, 46, 86,  3, 58, 51, 49, 61,  2,  3},
-            {49, 48, 72, 13, 72, 97, 69, 79, 91, 65, 72, 59,  4, 29, 95,  4, 88, 57,  6, 41},
-            {59, 53, 40, 47, 90, 98, 56, 36, 61, 39, 69, 22, 30, 23, 41, 23, 67, 85, 24, 37},
-            {11, 54, 82, 76,  1, 65, 99, 10, 27,  8, 30, 76, 15, 21, 71,  9, 49, 45, 97, 36},
-            {93, 98, 60, 15, 42, 86, 51, 23, 88, 87, 28, 34, 24, 25, 90, 62, 81, 69, 15, 74},
-            {38, 36, 59, 43, 74,  6, 59, 37, 53, 57, 46, 63, 23, 48,  3, 30, 89, 15, 91, 53},
-            { 5,  9, 59, 44, 54, 14, 47, 76, 47,  5, 75, 32, 57, 33, 68, 20, 43,  7, 32, 49},
-            {43, 78, 43, 13, 41, 99, 79, 83, 39, 56, 78, 72, 81, 92,  5, 69, 24, 87, 68, 77},
-            {82, 80, 72, 16, 15, 93, 67, 58, 14, 80, 34, 92, 77,  2, 18, 88, 70, 58, 17, 13},
-            {33, 88, 10, 18, 38, 54, 83, 99, 78,  2,  4, 72, 43, 12, 26, 22, 74, 61,  1, 37},
-            {26, 52, 63, 16, 24, 54, 58, 29, 90, 17, 23, 26, 82, 32,  2, 43, 44, 82, 49, 34},
-            {89, 30, 67, 18, 91, 92, 49, 35, 90, 84, 69, 46, 97, 38, 21, 63, 23, 73, 25, 31},
-            {86, 62, 12,  3, 49, 57, 50, 49, 50, 86, 33, 30,  3, 67, 86, 67, 89, 84, 46, 15},
-            {10,  8, 41, 11, 23, 39, 19, 89, 64, 65, 11, 49, 46, 93,  8, 22, 96, 63, 37, 32},
-            {16, 45,  5, 98, 63, 13, 64, 79, 94, 53,  5,  3, 86, 80, 33, 82, 80, 14, 56, 45},
-            {72, 77, 25,  9, 88, 70,  5, 82, 79,  5, 54, 81, 62, 75, 88, 41, 44, 73, 50, 50},
-            {96, 90, 67, 28,  1, 73,  5, 92, 10, 16, 42,  4, 26, 59, 33, 69, 69, 84,  9, 81},
-            {47, 52, 95, 44, 30, 16, 52, 45, 18, 58, 12, 46, 56, 51, 65, 81,  7,  9, 62, 46},
-            { 9, 39, 46, 14, 85, 43, 15, 42,  7, 60, 40, 95, 67,  7,  8, 21, 10, 38, 10, 93},
-            {56, 95, 37, 39, 22,  9, 26, 21, 26, 78, 30, 20, 87, 65, 89, 54, 15, 67, 89, 13},
-            { 8, 86, 41, 76, 94,  2, 67, 51, 51, 25, 51, 56, 46,  6, 46, 42, 55, 76, 66, 47},
-            {69, 15,  2, 92, 39, 76, 11, 30, 23, 71, 94, 57, 66, 59, 76, 53, 27, 18, 98, 50},
-            {87, 98, 25, 59, 70, 38, 77, 70, 43, 93, 24, 85, 53, 30, 57, 52, 55, 70, 10, 70},
-            {84, 59, 99, 95, 85, 66, 74,  2, 95, 99, 28, 31, 34, 67, 51, 26,  2, 69, 70, 21},
-            {62, 22, 48, 11,  7, 21, 88, 20, 57,  6, 84, 44, 52, 41, 58, 69, 82,  4, 92, 41},
-            {52, 43, 24, 55, 65, 32, 83, 82, 30, 62, 69,  1, 81, 32, 62, 80, 42, 58, 36, 12},
-            {82, 85, 18, 56, 43, 78, 96, 13, 86, 60, 44, 11, 68, 63, 59, 46, 88, 66, 82, 18},
-            {66, 93, 10, 16,  4, 41, 73, 92, 80, 33, 98, 72, 48,  7, 71, 10, 84, 11, 54, 28},
-            {67,  6, 23, 56, 60, 52, 59, 91, 55, 57, 36,  6,  4,  8, 12, 81, 38,  1, 34, 22},
-            {33, 46, 66, 23, 90, 88, 94,  2, 76, 79, 21, 68, 25, 89, 11, 99, 69, 51, 34, 60},
-            { 3, 51, 82, 84, 73, 76, 15, 80, 12,  7,  9, 62, 76, 51, 82,  6, 31, 38,  5, 69},
-            {53, 97, 84, 22, 21, 14, 50, 38, 91, 69, 48, 18, 46, 81, 56, 90,  5, 16, 12, 49},
-            {95, 79, 14, 32, 25, 86, 20, 54, 95, 82, 30, 21, 13,  9, 57, 79,  3, 81,  3, 38},
-            {42, 46, 13, 40, 33, 35, 54, 45, 28, 26, 15, 48, 72, 13, 53, 34, 37, 39, 56, 80},
-            {59, 71, 88, 47, 48, 81, 16, 19, 12, 41, 21, 32, 72, 27, 45, 56, 14, 56, 44, 52},
-            {77, 18,  7, 92, 25, 32, 33, 65, 18, 52, 43, 42, 82, 74, 96, 75, 35, 83, 41, 45},
-            {38, 33, 40, 61, 27, 75,  9, 35, 80, 38, 91, 79, 32, 59, 31, 54, 61, 27, 14, 34},
-            {12, 13, 20, 51, 37, 38, 74, 66, 32, 21, 49, 74, 25, 98, 39, 94, 43, 29, 25,  3},
-            { 1,  3, 68, 74, 63, 55, 11, 26, 67, 84, 86, 82, 58, 31, 12, 84, 38, 93, 78, 61},
-            {66, 32, 22, 85, 28, 96, 21, 18,  2, 74, 36,  3, 17, 98, 13, 55, 48, 70, 25, 96},
-            {24, 28, 92,  6, 88, 19, 97, 32,  4, 76, 41, 64, 99, 48,  8, 64, 89, 64, 89, 99},
-            {17, 48, 53, 13, 27, 35, 15, 51, 30, 16, 10, 90, 54, 74, 49, 14, 86, 22, 83, 49},
-            {58,  8, 16, 32, 94, 41, 43, 23, 64, 75, 75, 10, 81, 76,  4, 18, 37, 84, 78, 78},
-            {71, 42, 10,  8, 20, 77,  2, 18, 69, 75, 56, 72, 73, 75, 33,  6, 20, 25, 23, 34},
-            {88, 26, 23, 43, 54, 36,  1, 87, 76, 36, 70,  2, 93, 78, 22, 27, 33, 73, 51, 78},
-            {63, 26, 88, 30, 17, 24, 74, 74, 92, 79, 73, 49, 73, 11, 30, 20,  1, 81,  7, 79},
-            {60, 95, 65, 53, 74, 52, 37, 10, 50, 71, 57, 88, 79, 71, 34, 54,  8, 10, 20, 64},
-            {86, 44, 11, 24, 35, 60, 61, 76, 35, 82, 51, 53, 54, 54, 19, 30, 61, 46, 30, 55},
-            { 8, 74, 89,  2, 15, 43,  3, 31, 20, 70, 34, 59, 72, 10, 24, 58, 41, 32, 30, 63},
-            { 8, 82, 78, 11, 53, 30, 75, 31, 23, 22, 62, 88, 37, 96, 56, 35, 40, 38, 30, 24},
-            {44, 28, 94, 33, 64, 86, 41, 93, 52, 39,  3, 97, 68, 97, 96, 66, 10, 68, 63, 58},
-            {99,  4, 32, 27, 38,  6, 86, 61, 25,  8, 34, 98, 22, 75, 35, 85, 10, 40, 82, 25},
-            {80, 42, 64, 35, 79,  8, 51, 26, 82, 22, 27, 94, 94, 41, 43, 78, 75, 33, 40, 93},
-            {76, 81, 42, 40, 45, 31, 65, 39, 18, 79, 29, 95, 37, 30,  8, 15,  9, 79, 39, 73},
-            {94, 56, 74, 40, 67, 80, 42, 83,  2, 90, 25, 93, 15, 73,  5, 29, 81, 64, 37, 45},
-            {75, 38, 87, 96, 93, 82, 50, 11, 29, 55, 97, 95, 31, 84, 65, 31, 40, 36, 44, 93},
-            {63, 50, 63, 69, 16,  2, 48, 57, 70, 77, 30,  6, 46, 22, 64, 45, 13, 62,  2, 37},
-            {57, 12, 94, 23, 59, 59, 88, 81,  7,  3, 28,  1, 33,  8, 20, 41, 10, 82, 27, 64},
-            {76, 43, 87, 32, 47, 47, 52, 40, 36, 20, 48, 15, 82, 98, 54, 84, 53, 44, 71, 92},
-            {34, 51, 72, 13, 95, 21, 46, 97, 96, 61, 99, 66, 75, 68, 38, 51, 28, 99, 45, 59}
-        }
-    });
-
-    return instances;
-}
-
-#endif
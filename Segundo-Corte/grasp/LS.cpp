@@ -5,7 +5,8 @@ using namespace std;
 
 vector<int> local_search_insertion(vector<int> secuencia, 
                                    const vector<vector<int>>& tiempos, 
-                                   int m) {
+                                   int m,
+                                   long long* evaluaciones) {
     bool mejora = true;
     int n = secuencia.size();
 
@@ -24,6 +25,7 @@ vector<int> local_search_insertion(vector<int> secuencia,
                 vecino.erase(vecino.begin() + i);
                 vecino.insert(vecino.begin() + j, tarea);
                 int ms = calcular_makespan(vecino, tiempos, m);
+                if (evaluaciones) (*evaluaciones)++;
 
                 if (ms < mejor_makespan) {
                     // cout << "Consegui uno mejor" << endl;
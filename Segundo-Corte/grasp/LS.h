@@ -3,8 +3,10 @@
 
 #include <vector>
 
+// Si se pasa 'evaluaciones', se le suma el numero de vecinos evaluados
 std::vector<int> local_search_insertion(std::vector<int> secuencia,
                                         const std::vector<std::vector<int>>& tiempos,
-                                        int m);
+                                        int m,
+                                        long long* evaluaciones = nullptr);
 
 #endif
\ No newline at end of file
@@ -2,8 +2,11 @@
 #include <vector>
 #include <algorithm>
 #include <ctime>
+#include <random>
 #include "LS.h"
 #include "NEH.h"
+#include "grasp.h"
+#include "../genetic-algorithm/Budget.h"
 
 using namespace std;
 
@@ -15,13 +18,15 @@ int evaluarCandidato(vector<int> secuenciaActual, int trabajoNuevo, int n, int m
     return calcular_makespan(secuenciaActual, tiempos, m);
 }
 
-// Función para elegir un candidato de la RCL
-int elegirDeRCL(const vector<int>& candidatos, const vector<int>& secuencia, double alpha, int n, int m, const vector<vector<int>>& tiempos) {
+// Función para elegir un candidato de la RCL. Sin 'rng' se sortea con rand(), como
+// la versión original.
+int elegirDeRCL(const vector<int>& candidatos, const vector<int>& secuencia, double alpha, int n, int m, const vector<vector<int>>& tiempos, long long* evaluaciones, mt19937* rng) {
     int c_min = INF, c_max = -INF;
     vector<int> costos;
 
     for(int j : candidatos) {
         int c = evaluarCandidato(secuencia, j, n, m, tiempos);
+        if (evaluaciones) (*evaluaciones)++;
         costos.push_back(c);
         if(c < c_min) c_min = c;
         if(c > c_max) c_max = c;
@@ -33,17 +38,18 @@ int elegirDeRCL(const vector<int>& candidatos, const vector<int>& secuencia, dou
         if(costos[i] <= umbral) rcl_indices.push_back(i);
     }
     
+    if (rng) return rcl_indices[uniform_int_distribution<size_t>(0, rcl_indices.size() - 1)(*rng)];
     return rcl_indices[rand() % rcl_indices.size()];
 }
 
 // Fase de Construcción
-vector<int> faseConstruccion(int n, int m, double alpha, const vector<vector<int>>& tiempos) {
+vector<int> faseConstruccion(int n, int m, double alpha, const vector<vector<int>>& tiempos, long long* evaluaciones, mt19937* rng) {
     vector<int> secuencia;
     vector<int> candidatos;
     for(int i=0; i<n; i++) candidatos.push_back(i);
 
     while(!candidatos.empty()) {
-        int index = elegirDeRCL(candidatos, secuencia, alpha, n, m, tiempos);
+        int index = elegirDeRCL(candidatos, secuencia, alpha, n, m, tiempos, evaluaciones, rng);
         secuencia.push_back(candidatos[index]);
         candidatos.erase(candidatos.begin() + index);
     }
@@ -52,18 +58,46 @@ vector<int> faseConstruccion(int n, int m, double alpha, const vector<vector<int
 
 
 // Algoritmo GRASP Principal
-vector<int> ejecutarGRASP(int n, int m, const vector<vector<int>>& tiempos, int maxIter, double alpha) {
+vector<int> ejecutarGRASP(int n, int m, const vector<vector<int>>& tiempos, int maxIter, double alpha,
+                          double tiempo_limite_ms, long long* evaluaciones, unsigned int semilla,
+                          ConvergenceTrace* traza, PhaseProfile* perfil) {
     vector<int> mejorGlobal;
+    long long evaluacionesPropias = 0;
+    if (!evaluaciones) evaluaciones = &evaluacionesPropias;
+    PhaseProfile perfilPropio;
+    PhaseProfile& fases = perfil ? *perfil : perfilPropio;
+    // Con semilla, un generador propio: así varias corridas pueden ir en hilos distintos
+    mt19937 generador(semilla);
+    mt19937* rng = semilla != 0 ? &generador : nullptr;
     int mejorCostoGlobal = INF;
+    SearchBudget presupuesto(maxIter, tiempo_limite_ms);
+    if (traza) traza->restart(presupuesto.start());
 
-    for(int i=0; i < maxIter; i++) {
-        vector<int> sol = faseConstruccion(n, m, alpha, tiempos);
-        sol = local_search_insertion(sol, tiempos, m);
-        
-        int costo = calcular_makespan(sol, tiempos, m);
+    for(int i=0; i < maxIter || (maxIter <= 0 && tiempo_limite_ms > 0.0); i++) {
+        if (i > 0 && presupuesto.timeUp()) break;
+        vector<int> sol;
+        {
+            ScopedPhase fase(fases, Phase::Construction, evaluaciones);
+            sol = faseConstruccion(n, m, alpha, tiempos, evaluaciones, rng);
+        }
+        {
+            // Cada vecino de la búsqueda local es un makespan completo
+            ScopedPhase fase(fases, Phase::LocalSearch, evaluaciones);
+            long long antes = *evaluaciones;
+            sol = local_search_insertion(sol, tiempos, m, evaluaciones);
+            fases.count_neighbours(*evaluaciones - antes);
+        }
+
+        int costo;
+        {
+            ScopedPhase fase(fases, Phase::Evaluation, evaluaciones);
+            costo = calcular_makespan(sol, tiempos, m);
+            (*evaluaciones)++;
+        }
         if(costo < mejorCostoGlobal) {
             mejorCostoGlobal = costo;
             mejorGlobal = sol;
+            if (traza) traza->record(*evaluaciones, costo);
         }
     }
     return mejorGlobal;
@@ -1,11 +1,22 @@
 #ifndef GRASP_H
 #define GRASP_H
 
+#include "../genetic-algorithm/ConvergenceTrace.h"
+#include "../genetic-algorithm/PhaseProfile.h"
+
 #include <vector>
 
     // Declaración de funciones para que el main las reconozca
 std::vector<int> neh(int n, int m, const std::vector<std::vector<int>>& tiempos);
 int calcular_makespan(const std::vector<int>& secuencia, const std::vector<std::vector<int>>& tiempos, int m);
-std::vector<int> local_search_insertion(std::vector<int> secuencia, const std::vector<std::vector<int>>& tiempos, int m);
-std::vector<int> ejecutarGRASP(int n, int m, const std::vector<std::vector<int>>& tiempos, int maxIter, double alpha);
+std::vector<int> local_search_insertion(std::vector<int> secuencia, const std::vector<std::vector<int>>& tiempos, int m, long long* evaluaciones);
+// Se detiene tras maxIter iteraciones o al pasar tiempo_limite_ms (0 = sin limite), lo
+// que ocurra primero. Si se pasa 'evaluaciones', se le suman las secuencias evaluadas.
+// Con semilla 0 la construcción usa rand(); con otra, un generador propio de la corrida.
+// Si se pasa 'traza', se reinicia y recibe cada mejora de la mejor solución. Si se pasa
+// 'perfil' (make PROFILE=1), se le suman la construcción, la búsqueda local y la evaluación.
+std::vector<int> ejecutarGRASP(int n, int m, const std::vector<std::vector<int>>& tiempos, int maxIter, double alpha,
+                               double tiempo_limite_ms = 0.0, long long* evaluaciones = nullptr,
+                               unsigned int semilla = 0, ConvergenceTrace* traza = nullptr,
+                               PhaseProfile* perfil = nullptr);
 #endif
\ No newline at end of file
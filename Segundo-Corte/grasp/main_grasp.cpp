@@ -1,15 +1,18 @@
 #include "grasp.h"
-#include "Instances.h"
+#include "../genetic-algorithm/InstanceLoader.h"
 
 #include <chrono>
 #include <iostream>
 
 using namespace std;
 
-int main() {
-    auto instances = get_taillard_benchmark_instances();
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
 
     for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
 
         int iteraciones_grasp = 50;
         double alphas[] = {0.1, 0.3, 0.5, 0.7, 0.9};
@@ -17,13 +20,13 @@ int main() {
         for (double alpha : alphas) {
 
             auto inicio_grasp = chrono::high_resolution_clock::now();
-            vector<int> secuencia_grasp = ejecutarGRASP(instance.n, instance.m, instance.tiempos, iteraciones_grasp, alpha);
+            vector<int> secuencia_grasp = ejecutarGRASP(instance.n, instance.m, tiempos, iteraciones_grasp, alpha);
             auto fin_grasp = chrono::high_resolution_clock::now();
             chrono::duration<double> tiempo_grasp = fin_grasp - inicio_grasp;
 
             cout << "Secuencia GRASP (Alpha=" << alpha << "): ";
             for (int t : secuencia_grasp) cout << t+1 << " ";
-            cout << "\nMakespan GRASP: " << calcular_makespan(secuencia_grasp, instance.tiempos, instance.m) << endl;
+            cout << "\nMakespan GRASP: " << calcular_makespan(secuencia_grasp, tiempos, instance.m) << endl;
             cout << "Tiempo GRASP: " << tiempo_grasp.count() << "s" << endl;
             cout << "-------------------" << endl;
         }
@@ -1,15 +1,11 @@
 #include "TS.h"
 #include "NEH.h"
+#include "../genetic-algorithm/Budget.h"
 #include <vector>
 #include <queue>
 #include <limits>
 using namespace std;
 
-struct MovimientoTabu {
-    int job;
-    int pos_destino;
-};
-
 bool es_tabu(const queue<MovimientoTabu>& lista_tabu, int job, int pos_destino) {
     queue<MovimientoTabu> copia = lista_tabu;
     while (!copia.empty()) {
@@ -27,19 +23,37 @@ vector<int> tabu_search(vector<int> secuencia_inicial,
                                   int m,
                                   int max_iters,
                                   int tabu_tenure,
-                                  int max_sin_mejora) {
+                                  int max_sin_mejora,
+                                  double tiempo_limite_ms,
+                                  long long* evaluaciones,
+                                  ConvergenceTrace* traza,
+                                  PhaseProfile* perfil) {
 
     int n = secuencia_inicial.size();
+    long long evaluaciones_propias = 0;
+    if (!evaluaciones) evaluaciones = &evaluaciones_propias;
+    PhaseProfile perfil_propio;
+    PhaseProfile& fases = perfil ? *perfil : perfil_propio;
 
     vector<int> secuencia_actual = secuencia_inicial;
     vector<int> mejor_global = secuencia_actual;
 
-    int makespan_actual = calcular_makespan(secuencia_actual, tiempos, m);
+    int makespan_actual;
+    {
+        ScopedPhase fase(fases, Phase::Initialization, evaluaciones);
+        makespan_actual = calcular_makespan(secuencia_actual, tiempos, m);
+        (*evaluaciones)++;
+    }
     int mejor_makespan_global = makespan_actual;
 
     queue<MovimientoTabu> lista_tabu;
 
     int iter_sin_mejora = 0;
+    SearchBudget presupuesto(max_iters, tiempo_limite_ms);
+    if (traza) {
+        traza->restart(presupuesto.start());
+        traza->record(*evaluaciones, mejor_makespan_global);
+    }
 
     for (int iter = 0; iter < max_iters; ++iter) {
 
@@ -48,6 +62,9 @@ vector<int> tabu_search(vector<int> secuencia_inicial,
             break;
         }
 
+        // Criterio de parada por tiempo
+        if (presupuesto.timeUp()) break;
+
         int mejor_makespan_vecino = numeric_limits<int>::max();
         vector<int> mejor_vecino = secuencia_actual;
 
@@ -55,6 +72,7 @@ vector<int> tabu_search(vector<int> secuencia_inicial,
         int mejor_pos = -1;
 
         // Exploración completa de vecindad (inserción)
+        ScopedPhase fase(fases, Phase::LocalSearch, evaluaciones);
         for (int i = 0; i < n; ++i) {
             for (int j = 0; j < n; ++j) {
                 if (i == j) continue;
@@ -66,6 +84,8 @@ vector<int> tabu_search(vector<int> secuencia_inicial,
                 vecino.insert(vecino.begin() + j, job);
 
                 int ms = calcular_makespan(vecino, tiempos, m);
+                (*evaluaciones)++;
+                fases.count_neighbours();
 
                 bool tabu = es_tabu(lista_tabu, job, j);
 
@@ -92,6 +112,7 @@ vector<int> tabu_search(vector<int> secuencia_inicial,
         if (makespan_actual < mejor_makespan_global) {
             mejor_global = secuencia_actual;
             mejor_makespan_global = makespan_actual;
+            if (traza) traza->record(*evaluaciones, mejor_makespan_global);
             iter_sin_mejora = 0; // reinicia el contador
         } else {
             iter_sin_mejora++; // no hubo mejora
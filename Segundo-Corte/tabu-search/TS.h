@@ -1,14 +1,35 @@
 #ifndef TS_H
 #define TS_H
 
+#include "../genetic-algorithm/ConvergenceTrace.h"
+#include "../genetic-algorithm/PhaseProfile.h"
+
+#include <queue>
 #include <vector>
 using namespace std;
 
+struct MovimientoTabu {
+    int job;
+    int pos_destino;
+};
+
+// Si mover 'job' a 'pos_destino' está en la lista tabú
+bool es_tabu(const queue<MovimientoTabu>& lista_tabu, int job, int pos_destino);
+
+// Se detiene tras max_iters iteraciones, max_sin_mejora sin mejorar la mejor o al pasar
+// tiempo_limite_ms (0 = sin limite). Si se pasa 'evaluaciones', se le suman los vecinos
+// evaluados; si se pasa 'traza', se reinicia y recibe cada mejora de la mejor solucion.
+// Si se pasa 'perfil' (make PROFILE=1), se le suman la evaluacion inicial y la
+// exploracion de cada vecindad (como busqueda local).
 vector<int> tabu_search(vector<int> secuencia_inicial,
                                   const vector<vector<int>>& tiempos,
                                   int m,
                                   int max_iters,
                                   int tabu_tenure,
-                                  int max_sin_mejora);
+                                  int max_sin_mejora,
+                                  double tiempo_limite_ms = 0.0,
+                                  long long* evaluaciones = nullptr,
+                                  ConvergenceTrace* traza = nullptr,
+                                  PhaseProfile* perfil = nullptr);
 
 #endif
\ No newline at end of file
@@ -6,48 +6,16 @@
 #include <string>
 #include <chrono>
 
-using namespace std;
-
-class TaillardRNG {
-private:
-    static const long long a = 16807;
-    static const long long m = 2147483647;
-    static const long long b = 127773;
-    static const long long c = 2836;
-    long long seed;
-
-public:
-    TaillardRNG(long long s) : seed(s) {}
+#include "../genetic-algorithm/TaillardInstances.h"
 
-    double nextDouble() {
-        long long k = seed / b;
-        seed = a * (seed % b) - k * c;
-        if (seed < 0)
-            seed += m;
-        return (double)seed / m;
-    }
-
-    int nextInt(int low, int high) {
-        return low + (int)(nextDouble() * (high - low + 1));
-    }
-};
+using namespace std;
 
 // Función para generar una matriz de tiempos de procesamiento
+// TU FORMATO: [job][machine]. El generador de Taillard y sus semillas están en
+// TaillardInstances.h; los programas pueden pedir las instancias por nombre (ta001)
+// sin pasar por los archivos que escribe este programa.
 vector<vector<int>> generarMatrizPFSP(int n, int m, long long seed) {
-    TaillardRNG rng(seed);
-
-    // TU FORMATO: [job][machine]
-    vector<vector<int>> processingTimes(n, vector<int>(m));
-
-    // Taillard genera: for (machine) for (job)
-    // Nosotros transponemos al guardar
-    for (int machine = 0; machine < m; machine++) {
-        for (int job = 0; job < n; job++) {
-            processingTimes[job][machine] = rng.nextInt(1, 99);
-        }
-    }
-    
-    return processingTimes;
+    return taillard_instance(n, m, seed).job_rows();
 }
 
 // Función para guardar la matriz en un archivo con formato C++ vector<vector<int>>
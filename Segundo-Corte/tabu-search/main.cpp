@@ -3,10 +3,49 @@
 #include "NEH.h"
 #include "TS.h"
 #include <chrono>
+#include "../genetic-algorithm/InstanceLoader.h"
 
 using namespace std;
 
-int main() {
+// NEH y búsqueda tabú sobre una instancia (tiempos[j][k])
+static void ejecutar(int n, int m, const vector<vector<int>>& tiempos) {
+
+   // Solución inicial con NEH
+    vector<int> secuencia_inicial = neh(n, m, tiempos);
+
+    // Tabu Search
+    int max_iters = 10000;
+    int tabu_tenure = 7;
+    int max_sin_mejora = 1000;
+
+    auto inicio_ts = chrono::high_resolution_clock::now();
+    vector<int> secuencia_tabu = tabu_search(
+        secuencia_inicial, tiempos, m, max_iters, tabu_tenure, max_sin_mejora
+    );
+    auto fin_ts = chrono::high_resolution_clock::now();
+    chrono::duration<double> tiempo_ts = fin_ts - inicio_ts;
+
+    cout << "Secuencia TabuSearch: ";
+    for (int x : secuencia_tabu) cout << x + 1 << " ";
+    cout << "\nMakespan: " << calcular_makespan(secuencia_tabu, tiempos, m) << endl;
+    cout << "Tiempo TS: " << tiempo_ts.count() << " segundos" << endl;
+    cout << "\n";
+    cout << endl;
+}
+
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, la matriz de ejemplo
+    vector<string> rutas = instance_paths_from_args(argc, argv);
+    if (!rutas.empty()) {
+        vector<FlatInstance> instancias;
+        load_instances(rutas, instancias);
+        for (const auto& instancia : instancias) {
+            cout << "Instancia: " << instancia.name << " (n=" << instancia.n << ", m=" << instancia.m << ")" << endl;
+            ejecutar(instancia.n, instancia.m, instancia.job_rows());
+        }
+        return instancias.empty() ? 1 : 0;
+    }
+
     int n = 20, m = 5;
 
     vector<vector<int>> tiempos = {
@@ -31,27 +70,5 @@ int main() {
     {68,  5, 77, 51, 68},
     {94, 77, 40, 31, 28}
 };
-
-   // Solución inicial con NEH
-    vector<int> secuencia_inicial = neh(n, m, tiempos);
-
-    // Tabu Search
-    int max_iters = 10000;
-    int tabu_tenure = 7;
-    int max_sin_mejora = 1000;
-
-    auto inicio_ts = chrono::high_resolution_clock::now();
-    vector<int> secuencia_tabu = tabu_search(
-        secuencia_inicial, tiempos, m, max_iters, tabu_tenure, max_sin_mejora
-    );
-    auto fin_ts = chrono::high_resolution_clock::now();
-    chrono::duration<double> tiempo_ts = fin_ts - inicio_ts;
-
-    cout << "Secuencia TabuSearch: ";
-    for (int x : secuencia_tabu) cout << x + 1 << " ";
-    cout << "\nMakespan: " << calcular_makespan(secuencia_tabu, tiempos, m) << endl;
-    cout << "Tiempo TS: " << tiempo_ts.count() << " segundos" << endl;
-    cout << "\n";
-    cout << endl;
-
-}
\ No newline at end of file
+    ejecutar(n, m, tiempos);
+}
@@ -1,8 +1,11 @@
 #include "ACO.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceAggregates.h"
+#include "../../Segundo-Corte/genetic-algorithm/Budget.h"
 
 #include <algorithm>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <numeric>
 #include <random>
 #include <vector>
@@ -24,35 +27,6 @@ int compute_makespan_aco(const vector<int>& secuencia,
     return C[n][m];
 }
 
-static vector<int> neh_seed(const vector<vector<int>>& tiempos, int n, int m) {
-    vector<pair<int, int>> sumTimes;
-    sumTimes.reserve(n);
-    for (int job = 0; job < n; ++job) {
-        int s = accumulate(tiempos[job].begin(), tiempos[job].end(), 0);
-        sumTimes.push_back({s, job});
-    }
-    sort(sumTimes.begin(), sumTimes.end(), greater<pair<int, int>>());
-
-    vector<int> seq;
-    for (int i = 0; i < n; ++i) {
-        int job = sumTimes[i].second;
-        int bestMs = numeric_limits<int>::max();
-        vector<int> best;
-
-        for (int p = 0; p <= static_cast<int>(seq.size()); ++p) {
-            vector<int> cand = seq;
-            cand.insert(cand.begin() + p, job);
-            int ms = compute_makespan_aco(cand, tiempos, m);
-            if (ms < bestMs) {
-                bestMs = ms;
-                best = cand;
-            }
-        }
-        seq = best;
-    }
-    return seq;
-}
-
 static int sample_next_job(const vector<double>& weights, mt19937& rng) {
     double total = 0.0;
     for (double w : weights) total += w;
@@ -72,12 +46,12 @@ static int sample_next_job(const vector<double>& weights, mt19937& rng) {
     return static_cast<int>(weights.size()) - 1;
 }
 
-static vector<int> construct_solution(const vector<vector<double>>& tau,
-                                      const vector<double>& jobHeuristic,
-                                      int n,
-                                      int m,
-                                      const ACOParams& params,
-                                      mt19937& rng) {
+vector<int> construct_solution(const vector<vector<double>>& tau,
+                               const vector<double>& jobHeuristic,
+                               int n,
+                               int m,
+                               const ACOParams& params,
+                               mt19937& rng) {
     (void)m;
     vector<int> solution;
     solution.reserve(n);
@@ -120,33 +94,45 @@ ACOResult run_aco_pfsp(const vector<vector<int>>& tiempos,
                        int m,
                        const ACOParams& params) {
     mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
 
     vector<vector<double>> tau(n, vector<double>(n, 1.0));
+    unique_ptr<InstanceAggregates> localAggregates;
+    const InstanceAggregates& aggregates = aggregates_or_build(params.aggregates, localAggregates, tiempos, n, m);
+
     vector<double> jobHeuristic(n, 0.0);
     for (int job = 0; job < n; ++job) {
-        int total = accumulate(tiempos[job].begin(), tiempos[job].end(), 0);
-        jobHeuristic[job] = 1.0 / (1.0 + static_cast<double>(total));
+        jobHeuristic[job] = 1.0 / (1.0 + static_cast<double>(aggregates.job_total[job]));
     }
 
-    vector<int> seedSeq = neh_seed(tiempos, n, m);
+    vector<int> seedSeq = aggregates.neh_sequence();
     int seedMs = compute_makespan_aco(seedSeq, tiempos, m);
 
     ACOResult best;
+    best.trace.restart(budget.start());
     best.bestSequence = seedSeq;
     best.bestMakespan = seedMs;
+    best.evaluations = 1;
+    best.trace.record(best.evaluations, best.bestMakespan);
 
     const double tauMin = 1e-6;
     const double tauMax = 1e6;
 
-    for (int iter = 0; iter < params.iterations; ++iter) {
+    for (int iter = 0; !budget.exhausted(iter); ++iter) {
         vector<vector<int>> antSolutions;
         vector<int> antMs;
         antSolutions.reserve(params.antCount);
         antMs.reserve(params.antCount);
 
         for (int k = 0; k < params.antCount; ++k) {
-            vector<int> sol = construct_solution(tau, jobHeuristic, n, m, params, rng);
+            vector<int> sol;
+            {
+                ScopedPhase phase(best.profile, Phase::Construction);
+                sol = construct_solution(tau, jobHeuristic, n, m, params, rng);
+            }
+            ScopedPhase phase(best.profile, Phase::Evaluation, &best.evaluations);
             int ms = compute_makespan_aco(sol, tiempos, m);
+            best.evaluations++;
 
             antSolutions.push_back(sol);
             antMs.push_back(ms);
@@ -154,9 +140,11 @@ ACOResult run_aco_pfsp(const vector<vector<int>>& tiempos,
             if (ms < best.bestMakespan) {
                 best.bestMakespan = ms;
                 best.bestSequence = sol;
+                best.trace.record(best.evaluations, best.bestMakespan);
             }
         }
 
+        ScopedPhase phase(best.profile, Phase::PheromoneUpdate);
         for (int pos = 0; pos < n; ++pos) {
             for (int job = 0; job < n; ++job) {
                 tau[pos][job] *= (1.0 - params.rho);
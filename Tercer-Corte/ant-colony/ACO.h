@@ -1,22 +1,35 @@
 #ifndef ACO_H
 #define ACO_H
 
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
+#include <random>
 #include <vector>
 
+class InstanceAggregates;
+
 struct ACOParams {
     int antCount = 25;
     int iterations = 0;
+    double timeLimitMs = 0.0;        // 0 = sin limite de tiempo
     double alpha = 1.0;
     double beta = 2.0;
     double rho = 0.15;
     double q0 = 0.85;
     double Q = 100.0;
     unsigned int seed = 0;
+    // Agregados de la instancia (InstanceAggregates.h) si el llamador ya los tiene;
+    // si faltan se calculan en cada llamada
+    const InstanceAggregates* aggregates = nullptr;
 };
 
 struct ACOResult {
     std::vector<int> bestSequence;
     int bestMakespan = 0;
+    long long evaluations = 0;       // secuencias completas evaluadas
+    ConvergenceTrace trace;          // (tiempo, evaluaciones, makespan) de cada mejora
+    PhaseProfile profile;            // tiempo y evaluaciones por fase (make PROFILE=1)
 };
 
 ACOResult run_aco_pfsp(const std::vector<std::vector<int>>& tiempos,
@@ -28,4 +41,13 @@ int compute_makespan_aco(const std::vector<int>& secuencia,
                          const std::vector<std::vector<int>>& tiempos,
                          int m);
 
+// Secuencia de una hormiga: tau[posición][trabajo] y la heurística de cada trabajo.
+// Expuesta para los micro-benchmarks (Cuarto-Corte/benchmarks).
+std::vector<int> construct_solution(const std::vector<std::vector<double>>& tau,
+                                    const std::vector<double>& jobHeuristic,
+                                    int n,
+                                    int m,
+                                    const ACOParams& params,
+                                    std::mt19937& rng);
+
 #endif
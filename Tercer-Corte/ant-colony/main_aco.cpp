@@ -1,5 +1,5 @@
 #include "ACO.h"
-#include "../../Segundo-Corte/genetic-algorithm/Instances.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 #include <chrono>
 #include <iostream>
@@ -7,8 +7,10 @@
 
 using namespace std;
 
-int main() {
-    auto instances = get_taillard_benchmark_instances();
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
 
     vector<ACOParams> configs;
     {
@@ -33,6 +35,7 @@ int main() {
     }
 
     for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
         cout << "Instancia: " << instance.name
              << " (n=" << instance.n
              << ", m=" << instance.m
@@ -44,9 +47,10 @@ int main() {
             else if (instance.n <= 50) p.iterations = 180;
             else p.iterations = 120;
             p.seed = static_cast<unsigned int>(instance.seed);
+            p.aggregates = &instance.aggregates();
 
             auto start = chrono::high_resolution_clock::now();
-            ACOResult result = run_aco_pfsp(instance.tiempos, instance.n, instance.m, p);
+            ACOResult result = run_aco_pfsp(tiempos, instance.n, instance.m, p);
             auto end = chrono::high_resolution_clock::now();
             chrono::duration<double> elapsed = end - start;
 
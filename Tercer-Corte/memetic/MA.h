@@ -1,11 +1,15 @@
 #ifndef MA_H
 #define MA_H
 
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
+
 #include <vector>
 using namespace std;
 struct MAParams {
     int populationSize = 80;
     int iterations = 0;
+    double timeLimitMs = 0.0;        // 0 = sin limite de tiempo
     int tournamentSize = 3;
     double recombinationProb = 0.90;
     double mutationProb = 0.12;
@@ -17,6 +21,9 @@ struct MAParams {
 struct MAResult {
     std::vector<int> bestSequence;
     int bestMakespan = 0;
+    long long evaluations = 0;       // secuencias completas evaluadas
+    ConvergenceTrace trace;          // (tiempo, evaluaciones, makespan) de cada mejora
+    PhaseProfile profile;            // tiempo y evaluaciones por fase (make PROFILE=1)
 };
 
 MAResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
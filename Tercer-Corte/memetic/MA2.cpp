@@ -1,4 +1,5 @@
 #include "MA.h"
+#include "../../Segundo-Corte/genetic-algorithm/Budget.h"
 #include <iostream>
 #include <algorithm>
 #include <limits>
@@ -36,7 +37,9 @@ static vector<int> improve_by_insertion_sampled(vector<int> seq,
                                                 int m,
                                                 int maxPasses,
                                                 int maxTrialsPerPass,
-                                                mt19937& rng) {
+                                                mt19937& rng,
+                                                long long& evaluations,
+                                                PhaseProfile& profile) {
     if (seq.size() < 2) return seq;
 
     int n = static_cast<int>(seq.size());
@@ -44,6 +47,7 @@ static vector<int> improve_by_insertion_sampled(vector<int> seq,
 
     for (int pass = 0; pass < maxPasses; ++pass) {
         int currentMs = compute_makespan_ma(seq, tiempos, m);
+        evaluations++;
         bool improved = false;
 
         for (int t = 0; t < maxTrialsPerPass; ++t) {
@@ -57,6 +61,8 @@ static vector<int> improve_by_insertion_sampled(vector<int> seq,
             neighbor.insert(neighbor.begin() + j, job);
 
             int ms = compute_makespan_ma(neighbor, tiempos, m);
+            evaluations++;
+            profile.count_neighbours();
             if (ms < currentMs) {
                 seq = move(neighbor);
                 currentMs = ms;
@@ -244,6 +250,7 @@ MAResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
                                int m,
                                const MAParams& params) {
     mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
 
     vector<vector<int>> population;
     population.reserve(params.populationSize);
@@ -255,44 +262,58 @@ MAResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
     vector<int> makespans(params.populationSize, 0);
 
     MAResult best;
+    best.trace.restart(budget.start());
     best.bestMakespan = numeric_limits<int>::max();
 
     auto evaluate = [&]() {
         for (int i = 0; i < params.populationSize; ++i) {
             makespans[i] = compute_makespan_ma(population[i], tiempos, m);
+            best.evaluations++;
             if (makespans[i] < best.bestMakespan) {
                 best.bestMakespan = makespans[i];
                 best.bestSequence = population[i];
+                best.trace.record(best.evaluations, best.bestMakespan);
             }
         }
     };
 
-    evaluate();
+    {
+        ScopedPhase phase(best.profile, Phase::Initialization, &best.evaluations);
+        evaluate();
+    }
 
     uniform_real_distribution<double> prob(0.0, 1.0);
 
-    for (int iter = 0; iter < params.iterations; ++iter) {
-        vector<int> order(params.populationSize);
-        iota(order.begin(), order.end(), 0);
-        sort(order.begin(), order.end(), [&](int a, int b) {
-            return makespans[a] < makespans[b];
-        });
-
+    for (int iter = 0; !budget.exhausted(iter); ++iter) {
         vector<vector<int>> newPopulation;
         newPopulation.reserve(params.populationSize);
 
-        int elites = min(params.eliteCount, params.populationSize);
-        for (int e = 0; e < elites; ++e) {
-            newPopulation.push_back(population[order[e]]);
+        {
+            ScopedPhase phase(best.profile, Phase::Selection);
+            vector<int> order(params.populationSize);
+            iota(order.begin(), order.end(), 0);
+            sort(order.begin(), order.end(), [&](int a, int b) {
+                return makespans[a] < makespans[b];
+            });
+
+            int elites = min(params.eliteCount, params.populationSize);
+            for (int e = 0; e < elites; ++e) {
+                newPopulation.push_back(population[order[e]]);
+            }
         }
 
         while (static_cast<int>(newPopulation.size()) < params.populationSize) {
-            int i1 = tournament_select(population, makespans, params.tournamentSize, rng);
-            int i2 = tournament_select(population, makespans, params.tournamentSize, rng);
-            int i3 = tournament_select(population, makespans, params.tournamentSize, rng);
+            int i1, i2, i3;
+            {
+                ScopedPhase phase(best.profile, Phase::Selection);
+                i1 = tournament_select(population, makespans, params.tournamentSize, rng);
+                i2 = tournament_select(population, makespans, params.tournamentSize, rng);
+                i3 = tournament_select(population, makespans, params.tournamentSize, rng);
+            }
 
             vector<int> child;
             if (prob(rng) <= params.recombinationProb) {
+                ScopedPhase phase(best.profile, Phase::Recombination);
                 // child = multi_parent_recombination(population[i1], population[i2], population[i3], tiempos, m, rng);
                 child = sjox_three_parents(population[i1], population[i2], population[i3]);
             } else {
@@ -300,12 +321,17 @@ MAResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
             }
 
             if (prob(rng) <= params.mutationProb) {
+                ScopedPhase phase(best.profile, Phase::Mutation);
                 inversion_mutation(child, rng);
             }
             
 
             int maxTrials = min(6 * n, 180);
-            child = improve_by_insertion_sampled(child, tiempos, m, params.localSearchIters, maxTrials, rng);
+            {
+                ScopedPhase phase(best.profile, Phase::LocalSearch, &best.evaluations);
+                child = improve_by_insertion_sampled(child, tiempos, m, params.localSearchIters, maxTrials, rng,
+                                                     best.evaluations, best.profile);
+            }
             newPopulation.push_back(child);
         }
 
@@ -313,6 +339,7 @@ MAResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
 
         // remove_duplicates(population, rng);
 
+        ScopedPhase phase(best.profile, Phase::Evaluation, &best.evaluations);
         evaluate();
     }
 
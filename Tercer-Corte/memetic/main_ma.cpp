@@ -1,5 +1,5 @@
 #include "MA.h"
-#include "../../Segundo-Corte/genetic-algorithm/Instances.h"
+#include "../../Segundo-Corte/genetic-algorithm/InstanceLoader.h"
 
 #include <chrono>
 #include <iostream>
@@ -7,8 +7,10 @@
 
 using namespace std;
 
-int main() {
-    auto instances = get_taillard_benchmark_instances();
+int main(int argc, char** argv) {
+    // Archivos o directorios de instancias; sin argumentos, las de Instances.h
+    vector<FlatInstance> instances;
+    if (!instances_from_args(argc, argv, instances)) return 1;
 
     vector<MAParams> configs;
     {
@@ -73,6 +75,7 @@ int main() {
     }
 
     for (const auto& instance : instances) {
+        vector<vector<int>> tiempos = instance.job_rows();
         cout << "Instancia: " << instance.name
              << " (n=" << instance.n
              << ", m=" << instance.m
@@ -86,7 +89,7 @@ int main() {
             p.seed = static_cast<unsigned int>(instance.seed);
 
             auto start = chrono::high_resolution_clock::now();
-            MAResult result = run_memetic_algorithm(instance.tiempos, instance.n, instance.m, p);
+            MAResult result = run_memetic_algorithm(tiempos, instance.n, instance.m, p);
             auto end = chrono::high_resolution_clock::now();
             chrono::duration<double> elapsed = end - start;
 
@@ -1,4 +1,5 @@
 #include "SS.h"
+#include "../../Segundo-Corte/genetic-algorithm/Budget.h"
 #include <iostream>
 #include <algorithm>
 #include <limits>
@@ -35,15 +36,17 @@ static bool is_diverse(const vector<int>& candidate,
     return true;
 }
 
-static vector<int> path_relinking(const vector<int>& start,
-                                  const vector<int>& target,
-                                  const vector<vector<int>>& tiempos,
-                                  int m){
+vector<int> path_relinking(const vector<int>& start,
+                           const vector<int>& target,
+                           const vector<vector<int>>& tiempos,
+                           int m,
+                           long long& evaluations){
 
     vector<int> current = start;
     vector<int> best = start;
 
-    int bestMs = compute_makespan_ma(best, tiempos, m);
+    int bestMs = compute_makespan_ss(best, tiempos, m);
+    evaluations++;
 
     int n = start.size();
 
@@ -64,7 +67,8 @@ static vector<int> path_relinking(const vector<int>& start,
 
         swap(current[i], current[pos]);
 
-        int ms = compute_makespan_ma(current, tiempos, m);
+        int ms = compute_makespan_ss(current, tiempos, m);
+        evaluations++;
 
         if(ms < bestMs){
             bestMs = ms;
@@ -75,7 +79,7 @@ static vector<int> path_relinking(const vector<int>& start,
     return best;
 }
 
-int compute_makespan_ma(const vector<int>& secuencia,
+int compute_makespan_ss(const vector<int>& secuencia,
                         const vector<vector<int>>& tiempos,
                         int m) {
     int n = static_cast<int>(secuencia.size());
@@ -102,14 +106,17 @@ static vector<int> improve_by_insertion_sampled(vector<int> seq,
                                                 int m,
                                                 int maxPasses,
                                                 int maxTrialsPerPass,
-                                                mt19937& rng) {
+                                                mt19937& rng,
+                                                long long& evaluations,
+                                                PhaseProfile& profile) {
     if (seq.size() < 2) return seq;
 
     int n = static_cast<int>(seq.size());
     uniform_int_distribution<int> posDist(0, n - 1);
 
     for (int pass = 0; pass < maxPasses; ++pass) {
-        int currentMs = compute_makespan_ma(seq, tiempos, m);
+        int currentMs = compute_makespan_ss(seq, tiempos, m);
+        evaluations++;
         bool improved = false;
 
         for (int t = 0; t < maxTrialsPerPass; ++t) {
@@ -122,7 +129,9 @@ static vector<int> improve_by_insertion_sampled(vector<int> seq,
             neighbor.erase(neighbor.begin() + i);
             neighbor.insert(neighbor.begin() + j, job);
 
-            int ms = compute_makespan_ma(neighbor, tiempos, m);
+            int ms = compute_makespan_ss(neighbor, tiempos, m);
+            evaluations++;
+            profile.count_neighbours();
             if (ms < currentMs) {
                 seq = move(neighbor);
                 currentMs = ms;
@@ -188,7 +197,7 @@ static int tournament_select(const vector<vector<int>>& population,
 
 //     for (int job : candidates) {
 //         tmp.push_back(job);
-//         int ms = compute_makespan_ma(tmp, tiempos, m);
+//         int ms = compute_makespan_ss(tmp, tiempos, m);
 //         if (ms < bestMs) {
 //             bestMs = ms;
 //             bestJob = job;
@@ -305,11 +314,12 @@ static void inversion_mutation(vector<int>& ind, mt19937& rng) {
 //     }
 // }
 
-SSResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
-                               int n,
-                               int m,
-                               const SSParams& params) {
+SSResult run_scatter_search(const vector<vector<int>>& tiempos,
+                            int n,
+                            int m,
+                            const SSParams& params) {
     mt19937 rng(params.seed == 0 ? random_device{}() : params.seed);
+    SearchBudget budget(params.iterations, params.timeLimitMs);
 
     vector<vector<int>> population;
     population.reserve(params.populationSize);
@@ -321,44 +331,58 @@ SSResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
     vector<int> makespans(params.populationSize, 0);
 
     SSResult best;
+    best.trace.restart(budget.start());
     best.bestMakespan = numeric_limits<int>::max();
 
     auto evaluate = [&]() {
         for (int i = 0; i < params.populationSize; ++i) {
-            makespans[i] = compute_makespan_ma(population[i], tiempos, m);
+            makespans[i] = compute_makespan_ss(population[i], tiempos, m);
+            best.evaluations++;
             if (makespans[i] < best.bestMakespan) {
                 best.bestMakespan = makespans[i];
                 best.bestSequence = population[i];
+                best.trace.record(best.evaluations, best.bestMakespan);
             }
         }
     };
 
-    evaluate();
+    {
+        ScopedPhase phase(best.profile, Phase::Initialization, &best.evaluations);
+        evaluate();
+    }
 
     uniform_real_distribution<double> prob(0.0, 1.0);
 
-    for (int iter = 0; iter < params.iterations; ++iter) {
-        vector<int> order(params.populationSize);
-        iota(order.begin(), order.end(), 0);
-        sort(order.begin(), order.end(), [&](int a, int b) {
-            return makespans[a] < makespans[b];
-        });
-
+    for (int iter = 0; !budget.exhausted(iter); ++iter) {
         vector<vector<int>> newPopulation;
         newPopulation.reserve(params.populationSize);
 
-        int elites = min(params.eliteCount, params.populationSize);
-        for (int e = 0; e < elites; ++e) {
-            newPopulation.push_back(population[order[e]]);
+        {
+            ScopedPhase phase(best.profile, Phase::Selection);
+            vector<int> order(params.populationSize);
+            iota(order.begin(), order.end(), 0);
+            sort(order.begin(), order.end(), [&](int a, int b) {
+                return makespans[a] < makespans[b];
+            });
+
+            int elites = min(params.eliteCount, params.populationSize);
+            for (int e = 0; e < elites; ++e) {
+                newPopulation.push_back(population[order[e]]);
+            }
         }
 
         while (static_cast<int>(newPopulation.size()) < params.populationSize) {
-            int i1 = tournament_select(population, makespans, params.tournamentSize, rng);
-            int i2 = tournament_select(population, makespans, params.tournamentSize, rng);
-            int i3 = tournament_select(population, makespans, params.tournamentSize, rng);
+            int i1, i2, i3;
+            {
+                ScopedPhase phase(best.profile, Phase::Selection);
+                i1 = tournament_select(population, makespans, params.tournamentSize, rng);
+                i2 = tournament_select(population, makespans, params.tournamentSize, rng);
+                i3 = tournament_select(population, makespans, params.tournamentSize, rng);
+            }
 
             vector<int> child;
             if (prob(rng) <= params.recombinationProb) {
+                ScopedPhase phase(best.profile, Phase::Recombination);
                 // child = multi_parent_recombination(population[i1], population[i2], population[i3], tiempos, m, rng);
                 child = sjox_three_parents(population[i1], population[i2], population[i3]);
             } else {
@@ -366,12 +390,17 @@ SSResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
             }
 
             if (prob(rng) <= params.mutationProb) {
+                ScopedPhase phase(best.profile, Phase::Mutation);
                 inversion_mutation(child, rng);
             }
             
 
             int maxTrials = min(6 * n, 180);
-            child = improve_by_insertion_sampled(child, tiempos, m, params.localSearchIters, maxTrials, rng);
+            {
+                ScopedPhase phase(best.profile, Phase::LocalSearch, &best.evaluations);
+                child = improve_by_insertion_sampled(child, tiempos, m, params.localSearchIters, maxTrials, rng,
+                                                     best.evaluations, best.profile);
+            }
             newPopulation.push_back(child);
         }
 
@@ -393,27 +422,35 @@ SSResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
 
             if(i == j) continue;
 
+            ScopedPhase phase(best.profile, Phase::PathRelinking, &best.evaluations);
             vector<int> pr = path_relinking(population[i],
                                             population[j],
                                             tiempos,
-                                            m);
+                                            m,
+                                            best.evaluations);
 
             if(is_diverse(pr, population, params.diversityThreshold)){
                 population.push_back(pr);
             }
         }
 
-        evaluate();
+        {
+            ScopedPhase phase(best.profile, Phase::Evaluation, &best.evaluations);
+            evaluate();
+        }
 
         if(int(population.size()) > params.populationSize){
 
+        ScopedPhase phase(best.profile, Phase::Selection, &best.evaluations);
+
         vector<int> order(population.size());
         iota(order.begin(), order.end(), 0);
 
         vector<int> ms(population.size());
 
         for(int i = 0; i < int(population.size()); i++){
-            ms[i] = compute_makespan_ma(population[i], tiempos, m);
+            ms[i] = compute_makespan_ss(population[i], tiempos, m);
+            best.evaluations++;
         }
 
         sort(order.begin(), order.end(),
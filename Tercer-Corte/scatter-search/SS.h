@@ -1,11 +1,15 @@
-#ifndef MA_H
-#define MA_H
+#ifndef SS_H
+#define SS_H
+
+#include "../../Segundo-Corte/genetic-algorithm/ConvergenceTrace.h"
+#include "../../Segundo-Corte/genetic-algorithm/PhaseProfile.h"
 
 #include <vector>
 using namespace std;
 struct SSParams {
     int populationSize = 80;
     int iterations = 0;
+    double timeLimitMs = 0.0;        // 0 = sin limite de tiempo
     int tournamentSize = 3;
     double recombinationProb = 0.90;
     double mutationProb = 0.12;
@@ -19,15 +23,26 @@ struct SSParams {
 struct SSResult {
     std::vector<int> bestSequence;
     int bestMakespan = 0;
+    long long evaluations = 0;       // secuencias completas evaluadas
+    ConvergenceTrace trace;          // (tiempo, evaluaciones, makespan) de cada mejora
+    PhaseProfile profile;            // tiempo y evaluaciones por fase (make PROFILE=1)
 };
 
-SSResult run_memetic_algorithm(const vector<vector<int>>& tiempos,
-                               int n,
-                               int m,
-                               const SSParams& params);
+SSResult run_scatter_search(const vector<vector<int>>& tiempos,
+                            int n,
+                            int m,
+                            const SSParams& params);
 
-int compute_makespan_ma(const std::vector<int>& secuencia,
+int compute_makespan_ss(const std::vector<int>& secuencia,
                         const std::vector<std::vector<int>>& tiempos,
                         int m);
 
+// Camino de 'start' a 'target' por intercambios; devuelve la mejor secuencia del
+// camino. Expuesto para los micro-benchmarks (Cuarto-Corte/benchmarks).
+std::vector<int> path_relinking(const std::vector<int>& start,
+                                const std::vector<int>& target,
+                                const std::vector<std::vector<int>>& tiempos,
+                                int m,
+                                long long& evaluations);
+
 #endif